@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string_view>
+#include <cstddef>
+#include "core/document.h"
+
+namespace mdviewer {
+
+// Line-level checks on raw markdown, used to locate top-level block
+// boundaries without running the full parser. Positions are byte offsets
+// into `text`; a "line" argument is the offset where that line starts.
+class BlockScanner {
+public:
+    static size_t line_start(std::string_view text, size_t pos);
+    // Offset of the line's '\n', or text.size() on the last line
+    static size_t line_end(std::string_view text, size_t pos);
+    
+    static size_t skip_whitespace(std::string_view text, size_t pos);
+    // Skips indentation and blockquote markers
+    static size_t skip_container_prefix(std::string_view text, size_t pos);
+    // Skips a bullet or ordered list marker and the space after it
+    static size_t skip_list_marker(std::string_view text, size_t pos);
+    
+    static bool is_blank_line(std::string_view text, size_t line);
+    static bool is_closing_fence(std::string_view text, size_t line, char fence_char, size_t min_length = 3);
+    static bool is_setext_underline(std::string_view text, size_t line);
+    
+    // Whether a fenced code block or HTML block spanning [start, end) was
+    // closed by its own end marker rather than by running out of input
+    static bool is_fenced_code_closed(std::string_view text, size_t start, size_t end);
+    static bool is_html_block_closed(std::string_view text, size_t start, size_t end);
+    
+    // First line at or after `pos` that follows a blank line and cannot
+    // continue a block above it (not indented, not a list item), or
+    // text.size(). Fences and HTML blocks spanning blank lines are not
+    // detected here; callers check the block that ends before it.
+    static size_t next_block_boundary(std::string_view text, size_t pos);
+    
+    // Checks on top-level blocks the parser produced from `text`
+    static bool is_fenced(std::string_view text, const Document::Node& code_block);
+    // Whether a later line could still extend `block` after a blank line
+    static bool continues_past_blank_line(std::string_view text, const Document::Node& block);
+    // Whether `block`, the last one parsed before `line`, is finished, so
+    // that parsing on from `line` gives the same blocks with or without it
+    // in front
+    static bool ends_before(std::string_view text, const Document::Node& block, size_t line);
+    
+    // Conservative: reports anything shaped like "[label]: ..." at the start
+    // of a line, including inside blockquotes and list items
+    static bool contains_link_definition(std::string_view text);
+};
+
+} // namespace mdviewer
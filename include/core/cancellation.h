@@ -0,0 +1,22 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace mdviewer {
+
+// A flag shared by whoever starts some work and whoever decides it is no
+// longer wanted. Copies share the flag; work checks it now and then and
+// stops early once it is set.
+class CancellationToken {
+public:
+    CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+    
+    void cancel() const { cancelled_->store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelled_->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+} // namespace mdviewer
@@ -2,11 +2,17 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <memory>
 #include <variant>
 #include <optional>
 #include <string_view>
 #include <functional>
+#include <memory_resource>
+#include <deque>
+#include <mutex>
+#include <span>
+#include "core/text_offset_map.h"
 
 namespace mdviewer {
 
@@ -34,16 +40,33 @@ public:
         Strikethrough
     };
     
+    struct Node;
+    
+    // Arena-allocated nodes are released together with their Document's
+    // arena, so the deleter only frees nodes that were created with new.
+    // It frees a subtree from a worklist rather than through each node's
+    // destructor, so arbitrarily deep trees don't exhaust the stack.
+    struct NodeDeleter {
+        NodeDeleter() = default;
+        NodeDeleter(std::default_delete<Node>) {}
+        void operator()(Node* node) const;
+    };
+    using NodePtr = std::unique_ptr<Node, NodeDeleter>;
+    
     struct Node {
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+        
         NodeType type;
-        std::string content;
-        std::vector<std::unique_ptr<Node>> children;
+        // Not owned: views the Document's source buffer, or text the
+        // Document stored for it (see Document::store_text)
+        std::string_view content;
+        std::pmr::vector<NodePtr> children;
         
         // Metadata
         int heading_level = 0;
-        std::string code_language;
-        std::string link_url;
-        std::string image_alt;
+        std::pmr::string code_language;
+        std::pmr::string link_url;
+        std::pmr::string image_alt;
         bool list_ordered = false;
         int list_start = 1;
         
@@ -51,8 +74,15 @@ public:
         size_t source_start = 0;
         size_t source_end = 0;
         
-        Node(NodeType t) : type(t) {}
-        Node(NodeType t, std::string_view text) : type(t), content(text) {}
+        // Set by Document::create_node when the node lives in the arena
+        bool arena_allocated = false;
+        
+        explicit Node(NodeType t, const allocator_type& alloc = {})
+            : type(t), children(alloc),
+              code_language(alloc), link_url(alloc), image_alt(alloc) {}
+        Node(NodeType t, std::string_view text, const allocator_type& alloc = {})
+            : type(t), content(text), children(alloc),
+              code_language(alloc), link_url(alloc), image_alt(alloc) {}
     };
     
     struct Link {
@@ -60,45 +90,196 @@ public:
         std::string url;
         size_t position;
         bool is_wikilink = false;
+        bool is_embed = false;    // ![[...]]
     };
     
     struct TableOfContents {
         struct Entry {
             std::string text;
+            std::string slug;       // unique anchor, as GitHub makes it (see Slugger)
             int level;
-            size_t node_index;
+            size_t node_index;      // pre-order index of the heading node
+            size_t position = 0;    // the heading's source_start
+            size_t section_end = 0; // the next heading of this level or higher, or the end
             std::vector<Entry> children;
         };
         
+        // Top-level headings; each entry holds the deeper headings up to
+        // the next one of its level or higher
         std::vector<Entry> entries;
         
         void generate(const Node* root);
     };
     
+    // Where a heading anchor leads
+    struct Anchor {
+        size_t node_index;   // pre-order index of the heading node
+        size_t position;     // the heading's source_start
+        size_t section_end;  // see TableOfContents::Entry
+        int level;
+    };
+    
+    // A node as the type index records it
+    struct IndexedNode {
+        const Node* node;
+        const Node* parent;  // nullptr for the root
+        size_t index;        // pre-order index
+        size_t subtree_end;  // pre-order index past the node's last descendant
+        size_t start;        // source offset, clamped as for node_at_offset
+        int depth;           // 0 for the root
+    };
+    
     Document();
+    // Nodes created through create_node() are carved out of a monotonic
+    // arena drawing from `upstream`; size_hint seeds the first arena block.
+    explicit Document(std::pmr::memory_resource* upstream, size_t size_hint = 0);
     ~Document();
     
-    void set_root(std::unique_ptr<Node> root);
+    Document(const Document&) = delete;
+    Document& operator=(const Document&) = delete;
+    
+    NodePtr create_node(NodeType type);
+    bool uses_arena() const { return arena_ != nullptr; }
+    
+    // The markdown this Document was parsed from. Without an owner the bytes
+    // are copied into the Document; with one they are only kept alive.
+    void set_source(std::string_view source, std::shared_ptr<const void> owner = nullptr);
+    std::string_view source() const { return source_; }
+    
+    // Copies text that has no counterpart in the source (decoded entities,
+    // joined fragments) into storage that lives as long as the Document
+    std::string_view store_text(std::string_view text);
+    
+    // Const methods may be called from several threads at once; the
+    // indexes built on first use are built under a lock.
+    void set_root(NodePtr root);
     const Node* get_root() const { return root_.get(); }
     Node* get_root() { return root_.get(); }
+    // Drops cached counts and indexes; call after changing the tree in place
+    void mark_modified();
+    // Drops the tree, stored text and source, returning the arena's memory
+    void clear();
+    // Source bytes of the blocks that in-place edits replaced since the
+    // last clear(). Their nodes stay in the monotonic arena until then, so
+    // this stands in for the arena memory the tree no longer uses.
+    size_t replaced_bytes() const { return replaced_bytes_; }
+    void add_replaced_bytes(size_t bytes) { replaced_bytes_ += bytes; }
+    // Keeps `part` (and so every node and string it allocated) alive for
+    // as long as this Document, so subtrees built there can be moved in
+    void adopt(std::unique_ptr<Document> part);
+    // Keeps `base` alive for as long as this Document, so that arena nodes
+    // of its tree can also sit in this one's. This is how versions made by
+    // MarkdownParser::reparse_version share the blocks an edit left alone;
+    // neither Document may change afterwards.
+    void share(std::shared_ptr<const Document> base);
+    // How many versions back the shared blocks may come from; 0 when
+    // nothing is shared
+    size_t shared_depth() const { return shared_depth_; }
+    
+    // Link reference definitions resolve across the whole document, which
+    // rules out reparsing only part of it
+    bool has_link_definitions() const { return has_link_definitions_; }
+    void set_has_link_definitions(bool value) { has_link_definitions_ = value; }
     
     const TableOfContents& get_toc() const { return toc_; }
+    // Also rebuilds the anchor index
     void regenerate_toc();
     
-    size_t word_count() const;
-    size_t character_count() const;
+    // The heading a link fragment points to, in O(1): "#some-heading" or
+    // "some-heading", percent-encoded or not, or heading text as in
+    // [[Note#Some Heading]]. nullptr when no heading has that anchor.
+    const Anchor* find_anchor(std::string_view fragment) const;
+    // The source of the section an anchor leads to, heading included
+    std::string_view section_source(const Anchor& anchor) const;
+    
+    // Totals over a document, a section or a range of source
+    struct Stats {
+        size_t words = 0;
+        size_t characters = 0;  // user-perceived characters, not bytes (see TextCounter)
+        size_t lines = 0;       // source lines
+        size_t code_lines = 0;
+        size_t links = 0;
+        size_t images = 0;
+        
+        // Rounded up
+        size_t reading_minutes(size_t words_per_minute) const;
+    };
+    
+    // Statistics are counted in one pass over the nodes on first use and
+    // kept as running totals in document order, so any range is answered
+    // in O(log n) without reading text again
+    const Stats& stats() const;
+    // Nodes starting in [begin, end) and the source lines the range touches
+    Stats stats_in_range(size_t begin, size_t end) const;
+    // From `heading` to the next heading of the same or a higher level;
+    // empty when `heading` isn't a heading of this Document
+    Stats section_stats(const Node* heading) const;
+    
+    size_t word_count() const { return stats().words; }
+    size_t character_count() const { return stats().characters; }
     std::vector<Link> extract_links() const;
     
-    void visit(std::function<void(const Node&)> visitor) const;
+    // Source position lookups, answered in O(log n) from an index built on
+    // first use. Ranges are byte offsets into source(), end exclusive.
+    // Innermost node whose range contains `offset`, or nullptr
+    const Node* node_at_offset(size_t offset) const;
+    // Every node whose range overlaps [begin, end), in document order
+    std::vector<const Node*> nodes_in_range(size_t begin, size_t end) const;
+    // Byte, UTF-16 and line/column conversions over source(), for mapping
+    // node ranges to text view ranges and editor positions
+    const TextOffsetMap& offset_map() const;
+    // Takes `base`'s offset map, if it has built one, updated for the edit
+    // that turned base's source into this Document's, rather than building
+    // another on first use
+    void carry_offset_map(const Document& base, size_t offset, size_t removed_len, size_t inserted_len);
     
+    // Typed queries, answered from per-type lists of nodes in document
+    // order that are built on first use. Each costs O(log n) plus the size
+    // of its result.
+    std::span<const IndexedNode> nodes_of_type(NodeType type) const;
+    // Those starting in [begin, end) of the source
+    std::span<const IndexedNode> nodes_of_type(NodeType type, size_t begin, size_t end) const;
+    // Those in the section an anchor leads to, e.g. the links under a heading
+    std::span<const IndexedNode> nodes_of_type(NodeType type, const Anchor& section) const;
+    // Those below `ancestor`, which must come from this Document's index
+    std::span<const IndexedNode> nodes_of_type(NodeType type, const IndexedNode& ancestor) const;
+    // Code blocks whose info string names `language`, e.g. "mermaid"
+    std::span<const IndexedNode> code_blocks(std::string_view language) const;
+    
+    // Pre-order over every node. Prefer walk() and preorder() from
+    // core/node_visitor.h, which avoid the std::function call per node.
+    void visit(std::function<void(const Node&)> visitor) const;
+
 private:
-    std::unique_ptr<Node> root_;
+    // Declared before root_ so the tree is torn down before its storage
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena_;
+    std::deque<std::string> heap_text_;
+    std::vector<std::unique_ptr<Document>> parts_;
+    std::vector<std::shared_ptr<const Document>> shared_;
+    size_t shared_depth_ = 0;
+    size_t replaced_bytes_ = 0;
+    std::shared_ptr<const void> source_owner_;
+    std::string_view source_;
+    NodePtr root_;
     TableOfContents toc_;
-    mutable std::optional<size_t> cached_word_count_;
-    mutable std::optional<size_t> cached_char_count_;
+    std::unordered_map<std::string, Anchor> anchors_;
+    bool has_link_definitions_ = false;
+    
+    mutable std::mutex index_mutex_;
+    struct SourceIndex;
+    mutable std::unique_ptr<SourceIndex> source_index_;
+    const SourceIndex& source_index() const;
+    const SourceIndex& source_index_locked() const;
+    
+    struct StatsIndex;
+    mutable std::unique_ptr<StatsIndex> stats_index_;
+    const StatsIndex& stats_index() const;
+    
+    struct TypeIndex;
+    mutable std::unique_ptr<TypeIndex> type_index_;
+    const TypeIndex& type_index() const;
     
-    void visit_impl(const Node* node, std::function<void(const Node&)>& visitor) const;
-    size_t count_words_simd(std::string_view text) const;
+    mutable std::unique_ptr<TextOffsetMap> offset_map_;
 };
 
 } // namespace mdviewer
\ No newline at end of file
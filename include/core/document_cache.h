@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include "core/document.h"
+
+namespace mdviewer {
+
+// Parsed Documents saved in FileUtils::get_user_cache_directory(), one entry
+// per markdown file. An entry is a header, a flat pre-order node table and
+// a string pool; text that appears in the source is stored as an offset
+// into it rather than copied. Loading maps the entry read-only and builds
+// the tree in the Document's arena, with pooled text viewing the mapping.
+//
+// Entries record the hash of the source they were built from, the parser
+// options and the format version, and carry a checksum over everything
+// after the header. Anything that doesn't match is treated as a miss.
+class DocumentCache {
+public:
+    // Bump whenever the layout or the parser's output for the same input changes
+    static constexpr uint32_t format_version = 1;
+    
+    static std::filesystem::path entry_path(const std::filesystem::path& markdown_path);
+    
+    // `options` identifies the parser settings (MarkdownParser::options_key())
+    static bool store(const std::filesystem::path& markdown_path, const Document& document, uint32_t options);
+    // The cached tree for `markdown_path` if it was built from exactly
+    // `source` with the same options, else nullptr. As with
+    // MarkdownParser::parse, the Document keeps `owner` alive and views
+    // `source`; without an owner the source is copied.
+    static std::unique_ptr<Document> load(const std::filesystem::path& markdown_path,
+                                          std::string_view source, std::shared_ptr<const void> owner,
+                                          uint32_t options,
+                                          std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    
+    // The same on an explicit entry file
+    static bool write_entry(const std::filesystem::path& entry, const Document& document, uint32_t options);
+    static std::unique_ptr<Document> read_entry(const std::filesystem::path& entry,
+                                                std::string_view source, std::shared_ptr<const void> owner,
+                                                uint32_t options,
+                                                std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    
+    // 64-bit MurmurHash2 (64A) of `data`, used for keys and checksums
+    static uint64_t hash(std::string_view data, uint64_t seed = 0);
+};
+
+} // namespace mdviewer
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mdviewer {
+
+// YAML frontmatter at the top of a note, fenced by "---" lines:
+//
+//   ---
+//   title: Meeting notes
+//   tags: [work, planning]
+//   ---
+//
+// split() only locates the fences; yaml() and body() view the text passed
+// in, which must outlive the Frontmatter. Keys are indexed on first lookup
+// and cover the subset notes use: top-level "key: value" scalars (quotes
+// stripped), inline [a, b] lists, "- item" block lists and | or > blocks
+// (returned raw). Nested mappings are left to the caller to interpret.
+class Frontmatter {
+public:
+    struct Entry {
+        std::string_view key;
+        std::string_view value;
+        std::vector<std::string_view> items;
+    };
+    
+    Frontmatter() = default;
+    
+    static Frontmatter split(std::string_view text);
+    // Reads no more than `max_bytes` from the start of `path`, for indexing
+    // many notes without loading them. The Frontmatter owns what was read;
+    // body() is just the part of it after the closing fence. nullopt if the
+    // file can't be read.
+    static std::optional<Frontmatter> read_header(const std::filesystem::path& path, size_t max_bytes = 4096);
+    
+    bool present() const { return present_; }
+    // Between the fences, without them
+    std::string_view yaml() const { return yaml_; }
+    // Everything after the closing fence; the whole text when there is none
+    std::string_view body() const { return body_; }
+    size_t body_offset() const { return body_offset_; }
+    
+    const std::vector<Entry>& entries() const;
+    const Entry* find(std::string_view key) const;
+    // The scalar value for `key`, if it has one
+    std::optional<std::string_view> get(std::string_view key) const;
+    // List items for `key`; a scalar value counts as a one-item list
+    std::vector<std::string_view> get_list(std::string_view key) const;
+
+private:
+    std::shared_ptr<const std::string> storage_;  // only set by read_header
+    bool present_ = false;
+    std::string_view yaml_;
+    std::string_view body_;
+    size_t body_offset_ = 0;
+    mutable std::optional<std::vector<Entry>> entries_;
+};
+
+} // namespace mdviewer
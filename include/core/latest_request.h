@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include "core/cancellation.h"
+
+namespace mdviewer {
+
+// Keeps only the newest of a stream of requests, such as the reloads a
+// burst of saves sets off. Each request gets a ticket; a newer one cancels
+// the token of the one before, so work already under way stops early and
+// work still queued is skipped. A burst then costs about one parse.
+class LatestRequest {
+public:
+    // A request arrived: everything begun for earlier tickets is now stale
+    uint64_t supersede();
+    // The token to run `ticket`'s work with, or nothing if it is stale
+    std::optional<CancellationToken> start(uint64_t ticket) const;
+    bool is_current(uint64_t ticket) const;
+
+private:
+    mutable std::mutex mutex_;
+    uint64_t ticket_ = 0;
+    CancellationToken token_;
+};
+
+} // namespace mdviewer
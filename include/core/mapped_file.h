@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <system_error>
+
+namespace mdviewer {
+
+// The bytes of a file, read-only and loaded without copying them through
+// streams or strings. Files of map_threshold bytes or more are mapped, with
+// the kernel told they'll be read front to back, so loading costs about as
+// much as paging them in. Smaller files, and anything that can't be mapped
+// (pipes, some network volumes), are read into one buffer instead.
+//
+// bytes() stays valid for as long as the MappedFile does, so a shared
+// MappedFile can be passed to MarkdownParser::parse as the owner of its
+// input. A mapping only holds still while the file does: an editor that
+// replaces the file leaves it intact, but one that rewrites the file in
+// place shows through it, and one that truncates first makes the lost
+// pages fault. read() copies the file instead, for bytes that must stay
+// as they were after the file changes, such as a version a reload is
+// diffed against.
+class MappedFile {
+public:
+    static constexpr size_t map_threshold = 64 * 1024;
+
+    // nullptr if the file can't be opened or read, with the reason in `error`
+    static std::shared_ptr<const MappedFile> open(const std::filesystem::path& path, std::error_code& error);
+    static std::shared_ptr<const MappedFile> open(const std::filesystem::path& path);
+    // Same, but always read into a buffer of its own, whatever the size
+    static std::shared_ptr<const MappedFile> read(const std::filesystem::path& path, std::error_code& error);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // At least 16-byte aligned, page-aligned when mapped
+    std::string_view bytes() const { return {data_, size_}; }
+    size_t size() const { return size_; }
+    bool mapped() const { return mapped_; }
+
+private:
+    MappedFile() = default;
+    static std::shared_ptr<const MappedFile> load(const std::filesystem::path& path, std::error_code& error,
+                                                  bool allow_mapping);
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::unique_ptr<char[]> buffer_;
+};
+
+} // namespace mdviewer
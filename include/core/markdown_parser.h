@@ -4,7 +4,10 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <chrono>
+#include <optional>
 #include <memory_resource>
+#include "core/cancellation.h"
 #include "core/document.h"
 
 extern "C" {
@@ -17,30 +20,137 @@ class MarkdownParser {
 public:
     using ParseCallback = std::function<void(const Document::Node&)>;
     
+    // A change to a Document's source: `removed_len` bytes at `offset` were
+    // replaced with `inserted_text`
+    struct Edit {
+        size_t offset = 0;
+        size_t removed_len = 0;
+        std::string_view inserted_text;
+        
+        // The single edit turning `before` into `after`, found by trimming
+        // their common prefix and suffix. inserted_text views `after`.
+        static Edit between(std::string_view before, std::string_view after);
+    };
+    
+    // Bounds on a parse, checked every few md4c callbacks: it stops early
+    // once `token` is cancelled or `deadline` has passed
+    struct Limits {
+        std::optional<CancellationToken> token;
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+    };
+    
+    enum class ParseStatus {
+        Complete,
+        Cancelled,
+        TimedOut,
+    };
+    
+    struct ParseResult {
+        // Whatever was parsed before the parse stopped, unless it is Complete
+        std::unique_ptr<Document> document;
+        ParseStatus status = ParseStatus::Complete;
+        
+        bool complete() const { return status == ParseStatus::Complete; }
+    };
+    
     explicit MarkdownParser(std::pmr::memory_resource* memory = std::pmr::get_default_resource());
     ~MarkdownParser();
     
     std::unique_ptr<Document> parse(std::string_view input);
+    // Same as parse(), but the Document's arena draws from `memory` for this
+    // parse only. The resource must outlive the returned Document.
+    std::unique_ptr<Document> parse(std::string_view input, std::pmr::memory_resource* memory);
+    // Zero-copy variant: Text nodes view `input` directly and the Document
+    // keeps `owner` (whatever holds those bytes) alive.
+    std::unique_ptr<Document> parse(std::string_view input, std::shared_ptr<const void> owner);
+    // Same, stopping early when `limits` say so. A stale parse of a large
+    // file then returns within microseconds of being cancelled.
+    ParseResult parse(std::string_view input, std::shared_ptr<const void> owner, const Limits& limits);
     
     void parse_incremental(std::string_view input, ParseCallback callback);
     
+    // Applies `edit` to a Document produced by parse() and reparses only the
+    // top-level blocks it can affect, splicing the new blocks into the tree.
+    // Falls back to a full parse when the edit may change how the rest of
+    // the document parses (link reference definitions). Returns false and
+    // leaves the Document alone if the edit is out of range.
+    //
+    // The blocks an edit replaces stay in the Document's arena. Once they
+    // cover more source than the Document now holds, the next edit parses
+    // everything again, which empties the arena; repeated edits so keep
+    // at most about twice the memory of a fresh parse.
+    bool reparse(Document& document, const Edit& edit);
+    // Same, for callers that already hold the edited text: `edited` must be
+    // the source with `edit` applied, and the Document keeps `owner` alive.
+    bool reparse(Document& document, const Edit& edit,
+                 std::string_view edited, std::shared_ptr<const void> owner);
+    // Same, but `base` is left as it is for whoever still reads it: the
+    // result is a new version that shares the blocks the edit did not reach
+    // with `base`, keeping it alive. Returns nullptr if the edit is out of
+    // range.
+    std::shared_ptr<const Document> reparse_version(std::shared_ptr<const Document> base, const Edit& edit,
+                                                    std::string_view edited, std::shared_ptr<const void> owner = nullptr);
+    // Same, stopping early when `limits` say so, both in the blocks around
+    // the edit and in a fallback full parse. A stopped reparse returns
+    // nullptr, with the reason in `status`.
+    std::shared_ptr<const Document> reparse_version(std::shared_ptr<const Document> base, const Edit& edit,
+                                                    std::string_view edited, std::shared_ptr<const void> owner,
+                                                    const Limits& limits, ParseStatus* status = nullptr);
+    
     void detect_wikilinks(std::string_view text, std::vector<Document::Link>& links);
     
     void enable_github_extensions(bool enable = true);
     void enable_tables(bool enable = true);
     void enable_strikethrough(bool enable = true);
+    // When enabled (the default) every node, child array and string of a
+    // parsed Document comes from one monotonic arena owned by the Document.
+    void enable_arena_allocation(bool enable = true);
+    // Large inputs are split at top-level block boundaries and the pieces
+    // parsed concurrently, giving the same tree as a serial parse. 1 (the
+    // default) parses serially, 0 uses one thread per core. With more than
+    // one thread the parser's memory resource must be thread-safe.
+    void set_parse_threads(size_t threads);
     
+    // Identifies the options that change what parse() produces, for keying
+    // cached parse results
+    uint32_t options_key() const;
+
 private:
+    friend class StreamingParser;
     class Impl;
+    class Builder;
     std::unique_ptr<Impl> impl_;
     
+    std::unique_ptr<Document> make_document(std::pmr::memory_resource* memory, size_t size_hint) const;
+    std::unique_ptr<Document> make_document(size_t size_hint) const;
+    ParseStatus build(Document& document, const Limits* limits = nullptr) const;
+    // Parses builder.source from `begin` on; offsets stay relative to the
+    // start of builder.source
+    int run_md4c(Builder& builder, size_t begin) const;
+    Document::NodePtr parse_slice(Document& document, std::string_view source, size_t begin,
+                                  const Limits* limits = nullptr, ParseStatus* status = nullptr) const;
+    // Number of threads to parse `input` with, 1 meaning serially
+    size_t parse_threads_for(std::string_view input) const;
+    Document::NodePtr parse_parallel(Document& document, size_t threads, const Limits* limits, ParseStatus& status) const;
+    
+    // The top-level blocks [first, last) of a Document that an edit
+    // replaces, and a root parsed into `target` holding their replacements.
+    // No root means the whole document has to be parsed again.
+    struct Splice {
+        size_t first = 0;
+        size_t last = 0;
+        Document::NodePtr parsed;
+    };
+    // A parse stopped by `limits` gives no root either, with the reason in
+    // `status`.
+    Splice plan_splice(const Document& document, const Edit& edit, std::string_view edited, Document& target,
+                       const Limits* limits = nullptr, ParseStatus* status = nullptr) const;
+    
     static int enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata);
     static int leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata);
     static int enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata);
     static int leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata);
     static int text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata);
-    
-    void detect_wikilinks_simd(const char* text, size_t len, std::vector<Document::Link>& links);
 };
 
 } // namespace mdviewer
\ No newline at end of file
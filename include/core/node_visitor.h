@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "core/document.h"
+
+namespace mdviewer {
+
+// Document traversal without std::function or recursion. walk() calls a
+// visitor on each node in pre-order (document order); the visitor is
+// inlined, and overloads taking a NodeTag are picked per node type at
+// compile time:
+//
+//   walk(doc.get_root(), Overloaded{
+//       [&](const Document::Node& node, NodeTag<Document::NodeType::Link>) { ... },
+//       [&](const Document::Node& node, NodeTag<Document::NodeType::CodeBlock>) {
+//           ...
+//           return Visit::SkipChildren;
+//       },
+//   });
+//
+// A node with no overload for its type goes to one taking just the node,
+// if there is one. Visitors return void to carry on, or a Visit.
+//
+// preorder() is the same walk as an iterator, for range-for.
+
+enum class Visit {
+    Continue,
+    SkipChildren,  // go on with the node's next sibling
+    Stop,
+};
+
+template <Document::NodeType Type>
+struct NodeTag {
+    static constexpr Document::NodeType type = Type;
+};
+
+// One overload set out of several lambdas
+template <typename... Visitors>
+struct Overloaded : Visitors... {
+    using Visitors::operator()...;
+};
+template <typename... Visitors>
+Overloaded(Visitors...) -> Overloaded<Visitors...>;
+
+namespace detail {
+
+template <typename Visitor, typename... Args>
+Visit invoke_visitor(Visitor& visitor, const Args&... args) {
+    using Result = std::invoke_result_t<Visitor&, const Args&...>;
+    if constexpr (std::is_void_v<Result>) {
+        std::invoke(visitor, args...);
+        return Visit::Continue;
+    } else {
+        static_assert(std::is_same_v<Result, Visit>, "visitors return void or Visit");
+        return std::invoke(visitor, args...);
+    }
+}
+
+template <Document::NodeType Type, typename Visitor>
+Visit visit_as(Visitor& visitor, const Document::Node& node) {
+    if constexpr (std::is_invocable_v<Visitor&, const Document::Node&, const NodeTag<Type>&>) {
+        return invoke_visitor(visitor, node, NodeTag<Type>{});
+    } else if constexpr (std::is_invocable_v<Visitor&, const Document::Node&>) {
+        return invoke_visitor(visitor, node);
+    } else {
+        return Visit::Continue;
+    }
+}
+
+template <typename Visitor>
+Visit dispatch(Visitor& visitor, const Document::Node& node) {
+    using Type = Document::NodeType;
+    switch (node.type) {
+        case Type::Paragraph: return visit_as<Type::Paragraph>(visitor, node);
+        case Type::Heading: return visit_as<Type::Heading>(visitor, node);
+        case Type::CodeBlock: return visit_as<Type::CodeBlock>(visitor, node);
+        case Type::BlockQuote: return visit_as<Type::BlockQuote>(visitor, node);
+        case Type::List: return visit_as<Type::List>(visitor, node);
+        case Type::ListItem: return visit_as<Type::ListItem>(visitor, node);
+        case Type::Table: return visit_as<Type::Table>(visitor, node);
+        case Type::TableRow: return visit_as<Type::TableRow>(visitor, node);
+        case Type::TableCell: return visit_as<Type::TableCell>(visitor, node);
+        case Type::HorizontalRule: return visit_as<Type::HorizontalRule>(visitor, node);
+        case Type::Image: return visit_as<Type::Image>(visitor, node);
+        case Type::Link: return visit_as<Type::Link>(visitor, node);
+        case Type::Emphasis: return visit_as<Type::Emphasis>(visitor, node);
+        case Type::Strong: return visit_as<Type::Strong>(visitor, node);
+        case Type::Code: return visit_as<Type::Code>(visitor, node);
+        case Type::Text: return visit_as<Type::Text>(visitor, node);
+        case Type::LineBreak: return visit_as<Type::LineBreak>(visitor, node);
+        case Type::Html: return visit_as<Type::Html>(visitor, node);
+        case Type::Strikethrough: return visit_as<Type::Strikethrough>(visitor, node);
+    }
+    return Visit::Continue;
+}
+
+} // namespace detail
+
+// Visits `root` and everything under it; false when the visitor stopped
+template <typename Visitor>
+bool walk(const Document::Node* root, Visitor&& visitor) {
+    if (!root) {
+        return true;
+    }
+    
+    std::vector<const Document::Node*> pending{root};
+    while (!pending.empty()) {
+        const Document::Node* node = pending.back();
+        pending.pop_back();
+        
+        Visit next = detail::dispatch(visitor, *node);
+        if (next == Visit::Stop) {
+            return false;
+        }
+        if (next == Visit::Continue) {
+            for (auto it = node->children.rbegin(); it != node->children.rend(); ++it) {
+                pending.push_back(it->get());
+            }
+        }
+    }
+    return true;
+}
+
+template <typename Visitor>
+bool walk(const Document& document, Visitor&& visitor) {
+    return walk(document.get_root(), std::forward<Visitor>(visitor));
+}
+
+// Pre-order over a subtree. Children are only queued when the iterator
+// moves past their parent, so skip_children() can still drop them.
+class PreorderIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Document::Node;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Document::Node*;
+    using reference = const Document::Node&;
+    
+    PreorderIterator() = default;
+    explicit PreorderIterator(const Document::Node* root) : current_(root) {}
+    
+    reference operator*() const { return *current_; }
+    pointer operator->() const { return current_; }
+    
+    PreorderIterator& operator++() {
+        if (!skip_children_) {
+            for (auto it = current_->children.rbegin(); it != current_->children.rend(); ++it) {
+                pending_.push_back(it->get());
+            }
+        }
+        skip_children_ = false;
+        if (pending_.empty()) {
+            current_ = nullptr;
+        } else {
+            current_ = pending_.back();
+            pending_.pop_back();
+        }
+        return *this;
+    }
+    void operator++(int) { ++*this; }
+    
+    bool operator==(std::default_sentinel_t) const { return current_ == nullptr; }
+    
+    // Moves on to the current node's next sibling rather than its children
+    void skip_children() { skip_children_ = true; }
+
+private:
+    const Document::Node* current_ = nullptr;
+    std::vector<const Document::Node*> pending_;
+    bool skip_children_ = false;
+};
+
+class PreorderRange {
+public:
+    explicit PreorderRange(const Document::Node* root) : root_(root) {}
+    
+    PreorderIterator begin() const { return PreorderIterator(root_); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    const Document::Node* root_;
+};
+
+inline PreorderRange preorder(const Document::Node* root) {
+    return PreorderRange(root);
+}
+
+inline PreorderRange preorder(const Document& document) {
+    return PreorderRange(document.get_root());
+}
+
+} // namespace mdviewer
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "core/document.h"
+
+namespace mdviewer {
+
+// The current version of a file's Document, handed from the thread that
+// parses to the threads that read. A reader takes a snapshot, which keeps
+// that version alive however many are published after it; publishing is a
+// single atomic pointer swap, so readers never wait on a parse.
+//
+// Published Documents must not change. Versions from
+// MarkdownParser::reparse_version share their unchanged blocks, so keeping
+// several alive costs about what changed between them.
+class PublishedDocument {
+public:
+    using Snapshot = std::shared_ptr<const Document>;
+    
+    PublishedDocument() = default;
+    explicit PublishedDocument(Snapshot initial);
+    
+    PublishedDocument(const PublishedDocument&) = delete;
+    PublishedDocument& operator=(const PublishedDocument&) = delete;
+    
+    Snapshot snapshot() const;
+    // Makes `next` current and returns the version it replaced
+    Snapshot publish(Snapshot next);
+    // Publishes `next` only if `expected` is still current, so a parse
+    // started from an older version doesn't overwrite a newer one
+    bool publish_if_current(const Snapshot& expected, Snapshot next);
+    
+    // Counts publishes, for readers checking whether theirs is stale
+    uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<Snapshot> current_;
+#else
+    // Guarded by the std::atomic_* overloads for shared_ptr
+    Snapshot current_;
+#endif
+    std::atomic<uint64_t> generation_{0};
+};
+
+} // namespace mdviewer
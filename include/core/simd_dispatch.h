@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace mdviewer {
+
+// Instruction sets the vector kernels in mdviewer_core are built for. A
+// binary holds every level its architecture can run (the x86_64 slice of
+// the universal build has SSE4.2, AVX2 and AVX-512 kernels, the arm64
+// slice NEON) and chooses between them at runtime.
+enum class SimdLevel {
+    Scalar,
+    SSE42,
+    AVX2,
+    AVX512,
+    NEON,
+};
+
+class SimdDispatch {
+public:
+    // The level kernels run at: the best one this CPU supports, unless the
+    // INKWELL_SIMD environment variable names another supported level
+    // ("scalar", "sse4.2", "avx2", "avx512" or "neon"), which is useful for
+    // benchmarking. Decided on first use; unknown or unsupported names are
+    // ignored.
+    static SimdLevel active();
+    // The best level this CPU supports, ignoring INKWELL_SIMD
+    static SimdLevel detected();
+    static bool supported(SimdLevel level);
+    // Every supported level, scalar first
+    static std::vector<SimdLevel> supported_levels();
+    
+    static const char* name(SimdLevel level);
+    static std::optional<SimdLevel> parse(std::string_view name);
+};
+
+} // namespace mdviewer
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace mdviewer {
+
+// Heading anchors as GitHub generates them: the heading text lowercased,
+// with punctuation and symbols (emoji included) removed and each space
+// turned into a hyphen. A Slugger remembers the slugs it handed out and
+// makes repeats unique the same way, by appending -1, -2, ...
+//
+// Lowercasing covers ASCII, Latin-1, Latin Extended-A, Greek and
+// Cyrillic; other scripts are kept as written.
+class Slugger {
+public:
+    // The next unique slug for `text`
+    std::string slug(std::string_view text);
+    void reset() { occurrences_.clear(); }
+    
+    // The slug for `text`, without making it unique
+    static std::string slugify(std::string_view text);
+
+private:
+    std::unordered_map<std::string, size_t> occurrences_;
+};
+
+} // namespace mdviewer
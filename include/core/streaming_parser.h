@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include "core/document.h"
+
+namespace mdviewer {
+
+class MarkdownParser;
+
+// Push parser for input that arrives in pieces (large files, pipes). Each
+// top-level block goes to the callback as soon as the input seen so far
+// shows it is closed, so only the text of the block still open is held.
+//
+// A block is parsed without the text that follows it, so link reference
+// definitions only resolve links that reach the parser in the same batch.
+class StreamingParser {
+public:
+    // The block and the text it views are only valid during the call.
+    // Source offsets count from the first byte fed.
+    using BlockCallback = std::function<void(const Document::Node& block)>;
+    
+    StreamingParser(const MarkdownParser& parser, BlockCallback callback);
+    
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+    
+    void feed(std::string_view bytes);
+    // Emits whatever is still buffered; feeding after this starts a new stream
+    void finish();
+    
+    // Bytes of input held back because their blocks may not be closed yet
+    size_t buffered_bytes() const { return buffer_.size(); }
+
+private:
+    const MarkdownParser& parser_;
+    BlockCallback callback_;
+    std::string buffer_;
+    size_t consumed_ = 0;    // stream offset of buffer_[0]
+    size_t scan_from_ = 0;   // where the search for block boundaries resumes
+    size_t boundary_ = 0;    // last block boundary found in buffer_
+    size_t retry_size_ = 0;  // buffer size to wait for after finding an open block
+    
+    // Parses buffer_[0, end) and emits the blocks that are known to be closed
+    void flush(size_t end, bool final);
+};
+
+} // namespace mdviewer
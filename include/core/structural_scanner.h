@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "core/document.h"
+#include "core/simd_dispatch.h"
+
+namespace mdviewer {
+
+// Finds Obsidian-style [[wikilinks]], ![[embeds]] and #tags in raw
+// markdown, skipping code spans and fenced code blocks.
+//
+// The text is read in 64-byte blocks. A vector kernel first turns each
+// block into bitmasks of the few positions that matter ("[[", "]]", '|',
+// '#' after whitespace, backtick and tilde runs); only those bits are
+// then visited to pair brackets and step over code, so prose costs a
+// handful of instructions per block.
+class StructuralScanner {
+public:
+    struct Tag {
+        std::string_view name;  // without the '#'
+        size_t position;        // offset of the '#'
+    };
+    
+    // Appends the links in `text` in source order. url is the link target
+    // and text the alias after '|', or the target when there is none;
+    // position is the offset of the first '[' (of the '!' for embeds).
+    // Links don't span lines. Tags are appended to `tags` when given.
+    static void scan(std::string_view text, std::vector<Document::Link>& links,
+                     std::vector<Tag>* tags = nullptr);
+    // Same, with the block classifier for `level` rather than the active
+    // one; levels this CPU lacks fall back to scalar
+    static void scan(std::string_view text, std::vector<Document::Link>& links,
+                     std::vector<Tag>* tags, SimdLevel level);
+};
+
+} // namespace mdviewer
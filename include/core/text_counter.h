@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include "core/simd_dispatch.h"
+
+namespace mdviewer {
+
+// Word and character counts over UTF-8 text, run by the vector kernel
+// SimdDispatch picks.
+//
+// Words are maximal runs of characters other than whitespace (ASCII and
+// Unicode, e.g. U+00A0, U+2003, U+3000) and CJK punctuation. Chinese and
+// Japanese are written without spaces, so each Han, Hiragana or Katakana
+// character counts as a word of its own. Combining marks never start a
+// word.
+//
+// Characters approximate user-perceived characters (grapheme clusters):
+// combining marks, variation selectors and skin tone modifiers attach to
+// what precedes them, ZWJ emoji sequences and regional indicator pairs
+// (flags) count once, and so does CR LF.
+//
+// Malformed UTF-8 never fails: a truncated sequence counts as one
+// character, and continuation bytes that follow a complete one are
+// ignored.
+class TextCounter {
+public:
+    struct Counts {
+        size_t words = 0;
+        size_t codepoints = 0;
+        size_t characters = 0;
+    };
+    
+    static Counts count(std::string_view text);
+    // Same, with the kernel for `level`; levels this CPU lacks fall back
+    // to scalar, which is the reference the others must match
+    static Counts count(std::string_view text, SimdLevel level);
+    
+    static size_t count_words(std::string_view text);
+    static size_t count_words(std::string_view text, SimdLevel level);
+};
+
+} // namespace mdviewer
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "core/simd_dispatch.h"
+
+namespace mdviewer {
+
+// Conversions between the byte offsets the core works in, the UTF-16 code
+// units NSTextView ranges count, codepoints, and line/column positions,
+// over a UTF-8 text that must outlive the map.
+//
+// One vector pass over the text records a checkpoint about every
+// kilobyte holding the UTF-16 units, codepoints and newlines before it.
+// A conversion is a binary search over the checkpoints and a scan of at
+// most one interval. update() keeps the map in step with an edit by
+// rescanning only the intervals it touched.
+//
+// A byte offset inside a sequence converts as the offset just after it;
+// a UTF-16 offset between the halves of a surrogate pair converts to the
+// start of its sequence. Offsets past the end clamp to it. Lines end at
+// "\n" (so "\r\n" ends one line too); a lone "\r" doesn't end a line.
+// Malformed UTF-8 never fails: continuation bytes count for nothing, and
+// any other byte of 0xF0 or more counts as two UTF-16 units.
+class TextOffsetMap {
+public:
+    // Both zero-based; the column counts UTF-16 units from the line's start
+    struct LineColumn {
+        size_t line = 0;
+        size_t column = 0;
+
+        bool operator==(const LineColumn&) const = default;
+    };
+
+    TextOffsetMap();
+    explicit TextOffsetMap(std::string_view text);
+    // Same, built with the kernel for `level`; levels this CPU lacks fall
+    // back to scalar
+    TextOffsetMap(std::string_view text, SimdLevel level);
+
+    std::string_view text() const { return text_; }
+    size_t utf16_length() const { return checkpoints_.back().utf16; }
+    size_t codepoint_count() const { return checkpoints_.back().codepoints; }
+    size_t line_count() const { return checkpoints_.back().lines + 1; }
+
+    size_t utf16_from_byte(size_t byte) const;
+    size_t byte_from_utf16(size_t unit) const;
+    size_t codepoint_from_byte(size_t byte) const;
+    size_t byte_from_codepoint(size_t codepoint) const;
+
+    LineColumn line_column_from_byte(size_t byte) const;
+    // A column past the end of its line gives the line's end, and a line
+    // past the last gives the end of the text
+    size_t byte_from_line_column(LineColumn position) const;
+    // Byte offset where `line` starts
+    size_t line_start(size_t line) const;
+
+    // `text` is the map's text with `removed_len` bytes at `offset`
+    // replaced by `inserted_len` new ones
+    void update(std::string_view text, size_t offset, size_t removed_len, size_t inserted_len);
+
+private:
+    // Counts of what comes before `byte`
+    struct Checkpoint {
+        size_t byte = 0;
+        size_t utf16 = 0;
+        size_t codepoints = 0;
+        size_t lines = 0;
+    };
+
+    // Appends checkpoints for [from.byte, end) of the text to `out`,
+    // starting with `from` itself, and returns the counts at `end`
+    Checkpoint scan(Checkpoint from, size_t end, std::vector<Checkpoint>& out) const;
+    // The last checkpoint whose `field` is at most `value`
+    const Checkpoint& checkpoint_at(size_t Checkpoint::*field, size_t value) const;
+    Checkpoint counts_at(size_t byte) const;
+
+    std::string_view text_;
+    // The first is at 0 and the last at the end of the text
+    std::vector<Checkpoint> checkpoints_;
+    SimdLevel level_;
+};
+
+} // namespace mdviewer
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "core/document.h"
+
+namespace mdviewer {
+
+// The edit script that turns one table of contents into another, so a
+// sidebar showing the old one can update only the rows that changed.
+//
+// Headings are matched by identity rather than position: the k-th heading
+// with a given level and text continues the k-th such heading before. A
+// heading left unmatched whose neighbour before it matched (or which comes
+// first) continues the unmatched heading after that neighbour's old
+// counterpart when their levels agree, i.e. it was retitled in place.
+// Everything else was inserted or removed. A matched heading is moved when
+// its parent changed, or when it left the longest run of its siblings that
+// kept their order.
+//
+// Entries are counted by their pre-order index in each table. Computing a
+// script is linear in the number of headings, bar ordering the siblings
+// that were reshuffled.
+class TOCDiff {
+public:
+    using Entry = Document::TableOfContents::Entry;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    
+    struct Change {
+        enum class Kind { Insert, Remove, Move, Retitle };
+        
+        Kind kind;
+        size_t old_index = npos;  // unset for Insert
+        size_t new_index = npos;  // unset for Remove
+    };
+    
+    struct Script {
+        // Removes from the last old entry to the first, then inserts, moves
+        // and retitles in new order; an entry both moved and retitled has
+        // a change for each
+        std::vector<Change> changes;
+        // For each new entry, the old entry it continues, or npos
+        std::vector<size_t> matches;
+        
+        bool empty() const { return changes.empty(); }
+    };
+    
+    // An entry with where it sits in its table
+    struct Flat {
+        const Entry* entry;
+        size_t parent;   // pre-order index of the enclosing entry, or npos
+        size_t sibling;  // index among the parent's children
+    };
+    
+    static Script compute(const Document::TableOfContents& before, const Document::TableOfContents& after);
+    
+    // The entries of `toc` in pre-order, as Change counts them
+    static std::vector<Flat> flatten(const Document::TableOfContents& toc);
+};
+
+} // namespace mdviewer
@@ -1,29 +1,42 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace mdviewer {
 
+// Builds a table of contents straight from markdown text, without parsing
+// it into a Document. One pass over the lines finds ATX ("## Title") and
+// setext (underlined with = or -) headings, skipping fenced and indented
+// code; titles come out as plain text, with emphasis, code span, link and
+// HTML markup removed.
 class TOCGenerator {
 public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    
     struct TOCItem {
         std::string title;
         int level;
-        size_t offset;
+        size_t offset;                // start of the heading's first line
+        size_t parent = npos;         // index of the enclosing item
+        std::vector<size_t> children; // indexes of the items nested under it
     };
     
     struct TOC {
+        // Every heading in document order
         std::vector<TOCItem> items;
+        // Indexes of the items with no enclosing heading
+        std::vector<size_t> roots;
     };
     
     TOCGenerator() = default;
     ~TOCGenerator() = default;
     
-    TOC generate(const std::string& markdown);
+    TOC generate(std::string_view markdown);
     
-private:
-    static std::string stripMarkdownFormatting(const std::string& text);
+    // Heading text with its inline markup removed, as used for titles
+    static std::string strip_inline_markup(std::string_view text);
 };
 
-} // namespace mdviewer
\ No newline at end of file
+} // namespace mdviewer
@@ -10,6 +10,10 @@ class Document;
 
 #ifdef __OBJC__
 NSAttributedString* renderMarkdownDocument(const Document* doc, bool isDarkMode);
+
+// Rendered text carries the source offset (NSNumber) of the Text node it
+// came from, for mapping back through Document::node_at_offset
+extern NSString* const SourceOffsetAttributeName;
 #endif
 
 } // namespace mdviewer
\ No newline at end of file
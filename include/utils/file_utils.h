@@ -9,7 +9,8 @@ namespace mdviewer {
 
 class FileUtils {
 public:
-    // File reading/writing
+    // File reading/writing. read_file copies the whole file into a string;
+    // MappedFile views large files without copying.
     static std::optional<std::string> read_file(const std::filesystem::path& path);
     static bool write_file(const std::filesystem::path& path, const std::string& content);
     
@@ -1,31 +1,108 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
+#include "core/simd_dispatch.h"
 
 namespace mdviewer {
 
 class StringUtils {
 public:
-    // String trimming
+    // Encodings markdown files turn up in
+    enum class Encoding {
+        UTF8,
+        UTF16LE,
+        UTF16BE,
+        Latin1,
+        Windows1252,
+    };
+    
+    // A forward range over the pieces of a string, each found with memchr
+    // only when the iteration reaches it; the pieces view the string
+    class PieceRange {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+            
+            iterator() = default;
+            
+            reference operator*() const { return piece_; }
+            pointer operator->() const { return &piece_; }
+            iterator& operator++();
+            iterator operator++(int) {
+                iterator before = *this;
+                ++*this;
+                return before;
+            }
+            bool operator==(const iterator& other) const {
+                return done_ == other.done_ && (done_ || piece_.data() == other.piece_.data());
+            }
+            
+        private:
+            friend class PieceRange;
+            
+            std::string_view piece_;
+            std::string_view rest_;  // what follows piece_ and its delimiter
+            bool last_ = false;      // piece_ ran to the end of the string
+            bool done_ = true;
+            char delimiter_ = '\n';
+            bool lines_ = false;
+        };
+        
+        iterator begin() const;
+        iterator end() const { return {}; }
+        
+    private:
+        friend class StringUtils;
+        PieceRange(std::string_view str, char delimiter, bool lines)
+            : str_(str), delimiter_(delimiter), lines_(lines) {}
+        
+        std::string_view str_;
+        char delimiter_;
+        bool lines_;
+    };
+    
+    // String trimming; whitespace is what std::isspace takes it to be in
+    // the C locale. The _view forms return part of `str` rather than a copy.
     static std::string trim_left(const std::string& str);
     static std::string trim_right(const std::string& str);
     static std::string trim(const std::string& str);
+    static std::string_view trim_left_view(std::string_view str);
+    static std::string_view trim_right_view(std::string_view str);
+    static std::string_view trim_view(std::string_view str);
     
-    // String splitting
+    // String splitting. split() follows std::getline: no piece after a
+    // final delimiter, and none at all for an empty string. split_view()
+    // and split_range() give a piece on either side of every delimiter.
     static std::vector<std::string> split(const std::string& str, char delimiter);
     static std::vector<std::string_view> split_view(std::string_view str, char delimiter);
+    static PieceRange split_range(std::string_view str, char delimiter);
+    // The lines of `str` without their "\n" or "\r\n"; like split(), a
+    // final newline doesn't start another line
+    static PieceRange lines(std::string_view str);
     
     // String joining
     static std::string join(const std::vector<std::string>& parts, const std::string& separator);
     
-    // Case conversion
+    // Case conversion, of ASCII letters only, 32 bytes per step
     static std::string to_lower(const std::string& str);
     static std::string to_upper(const std::string& str);
+    static void to_lower_in_place(std::string& str);
+    static void to_upper_in_place(std::string& str);
     
-    // String replacement
+    // String replacement, left to right without overlaps. Both forms size
+    // their output once; the second appends to `out`. An empty `from`
+    // matches nothing.
     static std::string replace_all(const std::string& str, const std::string& from, const std::string& to);
+    static void replace_all(std::string_view str, std::string_view from, std::string_view to, std::string& out);
     
     // String checking
     static bool starts_with(std::string_view str, std::string_view prefix);
@@ -35,10 +112,45 @@ public:
     // String escape/unescape
     static std::string escape_html(const std::string& str);
     static std::string unescape_html(const std::string& str);
+    // The same, appending to `out` so that one buffer can be reused across
+    // calls. Escaping turns & < > " and ' into entities, skipping the runs
+    // between them with the vector kernel SimdDispatch picks. Unescaping
+    // decodes, in one pass, every HTML5 named character reference written
+    // with its semicolon and every numeric one ("&#233;", "&#xE9;"), with
+    // HTML5's fixes for numbers that aren't characters; anything else is
+    // left as it is.
+    static void escape_html(std::string_view str, std::string& out);
+    // Same, with the kernel for `level`; levels this CPU lacks fall back
+    // to scalar
+    static void escape_html(std::string_view str, std::string& out, SimdLevel level);
+    static void unescape_html(std::string_view str, std::string& out);
     
     // Unicode handling
     static size_t utf8_length(std::string_view str);
     static std::string utf8_substr(std::string_view str, size_t start, size_t length = std::string::npos);
+    
+    // UTF-8 validation, run by the vector kernel SimdDispatch picks. The
+    // offset of the first byte of the first malformed sequence (overlong,
+    // surrogate, above U+10FFFF, truncated, or a stray continuation byte),
+    // or npos when `str` is valid UTF-8.
+    static size_t find_invalid_utf8(std::string_view str);
+    // Same, with the kernel for `level`; levels this CPU lacks fall back
+    // to scalar, which is the reference the others must match
+    static size_t find_invalid_utf8(std::string_view str, SimdLevel level);
+    static bool is_valid_utf8(std::string_view str);
+    
+    // The encoding a byte order mark at the start of `bytes` names, with
+    // the mark's length in `bom_length`. Without a mark, text whose every
+    // other byte is mostly zero is UTF-16 and anything else is UTF-8.
+    static Encoding detect_encoding(std::string_view bytes, size_t* bom_length = nullptr);
+    // Appends `bytes` (without a byte order mark) to `out` as UTF-8. Strict
+    // decoding stops at malformed input and returns false, leaving `out`
+    // with what came before it. Lossy decoding always succeeds: in UTF-8,
+    // bytes that aren't part of a valid sequence are read as Windows-1252,
+    // which is what such bytes in a UTF-8 note almost always are; unpaired
+    // UTF-16 surrogates and a trailing odd byte become U+FFFD. Latin-1 and
+    // Windows-1252 are never malformed.
+    static bool to_utf8(std::string_view bytes, Encoding encoding, std::string& out, bool lossy = false);
 };
 
 } // namespace mdviewer
\ No newline at end of file
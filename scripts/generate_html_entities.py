@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Generate src/utils/html_entities.h, the perfect hash table of HTML5 named
+character references that StringUtils::unescape_html decodes.
+
+The names come from Python's copy of the WHATWG list (html.entities.html5),
+keeping those written with a semicolon. Each name hashes to a bucket, and
+each bucket gets a seed that sends its names to slots no other name uses,
+so a lookup is two hashes and one comparison.
+
+Usage: scripts/generate_html_entities.py > src/utils/html_entities.h
+"""
+
+import html.entities
+
+BUCKET_COUNT = 1024
+SLOT_COUNT = 4096
+MASK32 = 0xFFFFFFFF
+
+
+def entity_hash(name, seed):
+    """FNV-1a with a seed, mixed so the low bits depend on every byte.
+    Must match html_entities::hash."""
+    h = 2166136261 ^ seed
+    for c in name.encode('ascii'):
+        h = ((h ^ c) * 16777619) & MASK32
+    return h ^ (h >> 16)
+
+
+def c_literal(data):
+    return '"' + ''.join('\\x%02X' % b for b in data) + '"'
+
+
+def main():
+    entities = sorted((name[:-1], value) for name, value in html.entities.html5.items() if name.endswith(';'))
+
+    buckets = [[] for _ in range(BUCKET_COUNT)]
+    for index, (name, _) in enumerate(entities):
+        buckets[entity_hash(name, 0) % BUCKET_COUNT].append(index)
+
+    seeds = [0] * BUCKET_COUNT
+    slots = [None] * SLOT_COUNT
+    for bucket in sorted(range(BUCKET_COUNT), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, 1 << 16):
+            chosen = {entity_hash(entities[i][0], seed) % SLOT_COUNT for i in buckets[bucket]}
+            if len(chosen) == len(buckets[bucket]) and all(slots[s] is None for s in chosen):
+                break
+        else:
+            raise SystemExit('no seed for bucket %d' % bucket)
+        seeds[bucket] = seed
+        for i in buckets[bucket]:
+            slots[entity_hash(entities[i][0], seed) % SLOT_COUNT] = i
+
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('// Generated by scripts/generate_html_entities.py; do not edit.')
+    out.append('//')
+    out.append('// The %d HTML5 named character references written with a semicolon,' % len(entities))
+    out.append('// as a perfect hash: a name\'s bucket seed picks its slot, and the slot')
+    out.append('// holds its index in kEntities.')
+    out.append('')
+    out.append('#include <cstddef>')
+    out.append('#include <cstdint>')
+    out.append('#include <string_view>')
+    out.append('')
+    out.append('namespace mdviewer::html_entities {')
+    out.append('')
+    out.append('struct Entity {')
+    out.append('    std::string_view name;  // without the & and ;')
+    out.append('    std::string_view utf8;')
+    out.append('};')
+    out.append('')
+    out.append('constexpr size_t kLongestName = %d;' % max(len(name) for name, _ in entities))
+    out.append('constexpr uint32_t kBucketCount = %d;' % BUCKET_COUNT)
+    out.append('constexpr uint32_t kSlotCount = %d;' % SLOT_COUNT)
+    out.append('constexpr uint16_t kEmptySlot = 0xFFFF;')
+    out.append('')
+    out.append('constexpr uint32_t hash(std::string_view name, uint32_t seed) {')
+    out.append('    uint32_t h = 2166136261u ^ seed;')
+    out.append('    for (char c : name) {')
+    out.append('        h = (h ^ static_cast<unsigned char>(c)) * 16777619u;')
+    out.append('    }')
+    out.append('    return h ^ (h >> 16);')
+    out.append('}')
+    out.append('')
+    out.append('constexpr Entity kEntities[] = {')
+    for name, value in entities:
+        out.append('    {"%s", %s},' % (name, c_literal(value.encode('utf-8'))))
+    out.append('};')
+    out.append('')
+    out.append('constexpr uint16_t kSeeds[kBucketCount] = {')
+    for row in range(0, BUCKET_COUNT, 16):
+        out.append('    ' + ' '.join('%d,' % s for s in seeds[row:row + 16]))
+    out.append('};')
+    out.append('')
+    out.append('constexpr uint16_t kSlots[kSlotCount] = {')
+    for row in range(0, SLOT_COUNT, 16):
+        out.append('    ' + ' '.join('%d,' % (0xFFFF if s is None else s) for s in slots[row:row + 16]))
+    out.append('};')
+    out.append('')
+    out.append('// The decoded text of `name` (without the & and ;), or nullptr')
+    out.append('constexpr const Entity* find(std::string_view name) {')
+    out.append('    const uint16_t slot = kSlots[hash(name, kSeeds[hash(name, 0) % kBucketCount]) % kSlotCount];')
+    out.append('    return slot != kEmptySlot && kEntities[slot].name == name ? &kEntities[slot] : nullptr;')
+    out.append('}')
+    out.append('')
+    out.append('static_assert(find("amp") && find("amp")->utf8 == "&");')
+    out.append('static_assert(find("CounterClockwiseContourIntegral") && !find("ampx"));')
+    out.append('')
+    out.append('} // namespace mdviewer::html_entities')
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,227 @@
+#include "core/block_scanner.h"
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+namespace mdviewer {
+
+namespace {
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool starts_with_icase(std::string_view text, size_t pos, std::string_view prefix) {
+    if (text.size() - std::min(pos, text.size()) < prefix.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < prefix.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(text[pos + i])) != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t find_icase(std::string_view text, size_t from, std::string_view needle) {
+    for (size_t pos = from; pos + needle.size() <= text.size(); ++pos) {
+        if (starts_with_icase(text, pos, needle)) {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+} // namespace
+
+size_t BlockScanner::line_start(std::string_view text, size_t pos) {
+    pos = std::min(pos, text.size());
+    size_t newline = pos == 0 ? std::string_view::npos : text.rfind('\n', pos - 1);
+    return newline == std::string_view::npos ? 0 : newline + 1;
+}
+
+size_t BlockScanner::line_end(std::string_view text, size_t pos) {
+    size_t newline = text.find('\n', pos);
+    return newline == std::string_view::npos ? text.size() : newline;
+}
+
+size_t BlockScanner::skip_whitespace(std::string_view text, size_t pos) {
+    while (pos < text.size() && (is_space(text[pos]) || text[pos] == '\n')) {
+        ++pos;
+    }
+    return pos;
+}
+
+size_t BlockScanner::skip_container_prefix(std::string_view text, size_t pos) {
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '>')) {
+        ++pos;
+    }
+    return pos;
+}
+
+size_t BlockScanner::skip_list_marker(std::string_view text, size_t pos) {
+    if (pos + 1 < text.size() && (text[pos] == '-' || text[pos] == '*' || text[pos] == '+') &&
+        text[pos + 1] == ' ') {
+        return pos + 2;
+    }
+    
+    size_t digits = pos;
+    while (digits < text.size() && std::isdigit(static_cast<unsigned char>(text[digits]))) {
+        ++digits;
+    }
+    if (digits > pos && digits + 1 < text.size() &&
+        (text[digits] == '.' || text[digits] == ')') && text[digits + 1] == ' ') {
+        return digits + 2;
+    }
+    return pos;
+}
+
+bool BlockScanner::is_blank_line(std::string_view text, size_t line) {
+    size_t end = line_end(text, line);
+    for (size_t pos = line; pos < end; ++pos) {
+        if (!is_space(text[pos])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BlockScanner::is_closing_fence(std::string_view text, size_t line, char fence_char, size_t min_length) {
+    size_t pos = skip_container_prefix(text, line);
+    size_t run = 0;
+    while (pos < text.size() && text[pos] == fence_char) {
+        ++pos;
+        ++run;
+    }
+    return run >= std::max<size_t>(min_length, 3) && skip_whitespace(text, pos) >= line_end(text, line);
+}
+
+bool BlockScanner::is_setext_underline(std::string_view text, size_t line) {
+    size_t pos = skip_container_prefix(text, line);
+    size_t end = line_end(text, line);
+    if (pos >= end || (text[pos] != '=' && text[pos] != '-')) {
+        return false;
+    }
+    char marker = text[pos];
+    for (; pos < end; ++pos) {
+        if (text[pos] != marker && !is_space(text[pos])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BlockScanner::is_fenced_code_closed(std::string_view text, size_t start, size_t end) {
+    if (start >= text.size() || (text[start] != '`' && text[start] != '~')) {
+        return false;
+    }
+    char fence_char = text[start];
+    size_t open_length = 0;
+    while (start + open_length < text.size() && text[start + open_length] == fence_char) {
+        ++open_length;
+    }
+    
+    size_t last_line = line_start(text, end);
+    return last_line > line_start(text, start) && is_closing_fence(text, last_line, fence_char, open_length);
+}
+
+bool BlockScanner::is_html_block_closed(std::string_view text, size_t start, size_t end) {
+    std::string_view block = text.substr(0, std::min(end, text.size()));
+    
+    // CommonMark HTML blocks of kinds 1-5 run until an end marker; the
+    // others end at a blank line, which a block boundary always has
+    static constexpr std::string_view raw_tags[] = {"script", "pre", "style", "textarea"};
+    for (std::string_view tag : raw_tags) {
+        if (start < block.size() && block[start] == '<' && starts_with_icase(block, start + 1, tag)) {
+            size_t after = start + 1 + tag.size();
+            if (after >= block.size() || is_space(block[after]) || block[after] == '>' || block[after] == '\n') {
+                std::string closing = "</" + std::string(tag) + ">";
+                return find_icase(block, after, closing) != std::string_view::npos;
+            }
+        }
+    }
+    
+    std::string_view head = block.substr(std::min(start, block.size()));
+    if (head.substr(0, 4) == "<!--") {
+        return block.find("-->", start + 4) != std::string_view::npos;
+    }
+    if (head.substr(0, 2) == "<?") {
+        return block.find("?>", start + 2) != std::string_view::npos;
+    }
+    if (head.substr(0, 9) == "<![CDATA[") {
+        return block.find("]]>", start + 9) != std::string_view::npos;
+    }
+    if (head.size() > 2 && head.substr(0, 2) == "<!" && std::isalpha(static_cast<unsigned char>(head[2]))) {
+        return block.find('>', start + 2) != std::string_view::npos;
+    }
+    return true;
+}
+
+size_t BlockScanner::next_block_boundary(std::string_view text, size_t pos) {
+    size_t line = pos == 0 ? 0 : line_end(text, pos - 1) + 1;
+    bool after_blank = line > 0 && line <= text.size() && is_blank_line(text, line_start(text, line - 1));
+    while (line < text.size()) {
+        bool blank = is_blank_line(text, line);
+        // Indented lines and list items could still belong to a list or
+        // indented code block above the blank line
+        if (after_blank && !blank && !is_space(text[line]) && skip_list_marker(text, line) == line) {
+            return line;
+        }
+        after_blank = blank;
+        line = line_end(text, line) + 1;
+    }
+    return text.size();
+}
+
+bool BlockScanner::is_fenced(std::string_view text, const Document::Node& code_block) {
+    return code_block.source_start < text.size() &&
+           (text[code_block.source_start] == '`' || text[code_block.source_start] == '~');
+}
+
+bool BlockScanner::continues_past_blank_line(std::string_view text, const Document::Node& block) {
+    return block.type == Document::NodeType::List ||
+           (block.type == Document::NodeType::CodeBlock && !is_fenced(text, block));
+}
+
+bool BlockScanner::ends_before(std::string_view text, const Document::Node& block, size_t line) {
+    size_t content = skip_whitespace(text, line);
+    bool indented = content > line;
+    char lead = content < text.size() ? text[content] : '\0';
+    
+    switch (block.type) {
+        case Document::NodeType::List:
+            return !indented && lead != '-' && lead != '+' && lead != '*' &&
+                   !std::isdigit(static_cast<unsigned char>(lead));
+        case Document::NodeType::CodeBlock:
+            return is_fenced(text, block)
+                ? is_fenced_code_closed(text, block.source_start, block.source_end)
+                : !indented;
+        case Document::NodeType::Html:
+            return is_html_block_closed(text, block.source_start, block.source_end);
+        default:
+            return true;
+    }
+}
+
+bool BlockScanner::contains_link_definition(std::string_view text) {
+    // One pass over the lines, each looked into only when its content
+    // opens with '[', so a long line with many "]:" costs no more than
+    // reading it
+    for (size_t line = 0; line < text.size(); line = line_end(text, line) + 1) {
+        size_t pos = skip_container_prefix(text, line);
+        
+        // Definitions may also open a list item
+        pos = skip_container_prefix(text, skip_list_marker(text, pos));
+        
+        if (pos < text.size() && text[pos] == '[') {
+            size_t end = line_end(text, pos);
+            size_t hit = text.substr(0, end).find("]:", pos + 1);
+            if (hit != std::string_view::npos) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace mdviewer
@@ -1,196 +1,662 @@
 #include "core/document.h"
+#include "core/node_visitor.h"
+#include "core/slugger.h"
+#include "core/text_counter.h"
 #include <algorithm>
+#include <array>
 #include <numeric>
 #include <functional>
-#ifdef __x86_64__
-#include <immintrin.h>
-#elif defined(__aarch64__)
-#include <arm_neon.h>
-#endif
 
 namespace mdviewer {
 
-Document::Document() = default;
-Document::~Document() = default;
+// Nodes in pre-order, which is also source order. Each node's range is
+// clamped into its parent's so the ranges nest even where the parser's
+// block heuristics were off. The offsets are then cut into segments that
+// each record their innermost covering node.
+struct Document::SourceIndex {
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    
+    struct Entry {
+        const Node* node;
+        size_t start;
+        size_t end;
+        size_t parent;
+    };
+    
+    std::vector<Entry> entries;
+    std::vector<size_t> boundaries;
+    std::vector<size_t> owners;
+    
+    explicit SourceIndex(const Node* root);
+    size_t innermost(size_t offset) const;
 
-void Document::regenerate_toc() {
-    // Simple implementation - extract headings
-    toc_.entries.clear();
-    if (!root_) return;
+private:
+    void paint(size_t at, size_t owner);
+};
+
+Document::SourceIndex::SourceIndex(const Node* root) {
+    if (!root) {
+        return;
+    }
     
-    size_t node_index = 0;
-    std::function<void(const Node*)> extract = [&](const Node* node) {
-        if (node->type == NodeType::Heading && node->heading_level > 0) {
-            TableOfContents::Entry entry;
-            entry.text = node->content;
-            entry.level = node->heading_level;
-            entry.node_index = node_index;
-            toc_.entries.push_back(entry);
+    entries.push_back({root, root->source_start, std::max(root->source_start, root->source_end), npos});
+    
+    // (entry index, next child to visit); siblings may not start before the
+    // previous sibling ended
+    std::vector<std::pair<size_t, size_t>> stack{{0, 0}};
+    std::vector<size_t> sibling_end{root->source_start};
+    while (!stack.empty()) {
+        auto& [index, next_child] = stack.back();
+        const Node* node = entries[index].node;
+        if (next_child == node->children.size()) {
+            stack.pop_back();
+            sibling_end.pop_back();
+            continue;
         }
-        node_index++;
         
-        for (const auto& child : node->children) {
-            extract(child.get());
+        const Node* child = node->children[next_child++].get();
+        const Entry& parent = entries[index];
+        size_t start = std::clamp(child->source_start, std::max(parent.start, sibling_end.back()), parent.end);
+        size_t end = std::clamp(child->source_end, start, parent.end);
+        sibling_end.back() = end;
+        
+        entries.push_back({child, start, end, index});
+        stack.emplace_back(entries.size() - 1, 0);
+        sibling_end.push_back(start);
+    }
+    
+    std::vector<size_t> open;
+    auto close_until = [&](size_t offset) {
+        while (!open.empty() && entries[open.back()].end <= offset) {
+            size_t closed = open.back();
+            open.pop_back();
+            paint(entries[closed].end, open.empty() ? npos : open.back());
         }
     };
-    
-    extract(root_.get());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        close_until(entries[i].start);
+        paint(entries[i].start, i);
+        open.push_back(i);
+    }
+    close_until(npos);
 }
 
-void Document::set_root(std::unique_ptr<Node> root) {
-    root_ = std::move(root);
-    cached_word_count_.reset();
-    cached_char_count_.reset();
+void Document::SourceIndex::paint(size_t at, size_t owner) {
+    if (!boundaries.empty() && boundaries.back() == at) {
+        owners.back() = owner;
+    } else {
+        boundaries.push_back(at);
+        owners.push_back(owner);
+    }
 }
 
-size_t Document::word_count() const {
-    if (!cached_word_count_.has_value()) {
-        size_t count = 0;
-        visit([this, &count](const Node& node) {
-            if (node.type == NodeType::Text) {
-                count += count_words_simd(node.content);
-            }
-        });
-        cached_word_count_ = count;
+size_t Document::SourceIndex::innermost(size_t offset) const {
+    auto it = std::upper_bound(boundaries.begin(), boundaries.end(), offset);
+    if (it == boundaries.begin()) {
+        return npos;
     }
-    return cached_word_count_.value();
+    return owners[it - boundaries.begin() - 1];
 }
 
-size_t Document::character_count() const {
-    if (!cached_char_count_.has_value()) {
-        size_t count = 0;
-        visit([&count](const Node& node) {
-            if (node.type == NodeType::Text) {
-                count += node.content.size();
-            }
-        });
-        cached_char_count_ = count;
+// Running totals over the source index's entries: prefix[i] sums the
+// entries before i. Lines come from the source's newline offsets, and
+// each heading records where its section ends.
+struct Document::StatsIndex {
+    struct Section {
+        size_t start;
+        size_t end;
+        const Node* heading;
+    };
+    
+    std::vector<Stats> prefix;
+    std::vector<size_t> newlines;
+    std::vector<Section> sections;
+    Stats total;
+    
+    StatsIndex(const SourceIndex& index, std::string_view source);
+    // Nodes starting in [begin, end), lines left at zero
+    Stats nodes_between(const SourceIndex& index, size_t begin, size_t end) const;
+    size_t lines_between(size_t begin, size_t end) const;
+};
+
+// Posting lists over the source index's entries, one per node type, plus
+// the code blocks grouped by language. Entries keep pre-order, so a
+// subtree or a source range is a contiguous run of each list.
+struct Document::TypeIndex {
+    static constexpr size_t type_count = static_cast<size_t>(NodeType::Strikethrough) + 1;
+    
+    std::array<std::vector<IndexedNode>, type_count> by_type;
+    std::unordered_map<std::string, std::vector<IndexedNode>> code_by_language;
+    
+    explicit TypeIndex(const SourceIndex& index);
+};
+
+Document::TypeIndex::TypeIndex(const SourceIndex& index) {
+    const auto& entries = index.entries;
+    std::vector<size_t> subtree_end(entries.size());
+    std::iota(subtree_end.begin(), subtree_end.end(), size_t{1});
+    for (size_t i = entries.size(); i-- > 1;) {
+        size_t parent = entries[i].parent;
+        subtree_end[parent] = std::max(subtree_end[parent], subtree_end[i]);
+    }
+    
+    std::vector<int> depth(entries.size(), 0);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        const Node* parent = nullptr;
+        if (entry.parent != SourceIndex::npos) {
+            depth[i] = depth[entry.parent] + 1;
+            parent = entries[entry.parent].node;
+        }
+        
+        IndexedNode indexed{entry.node, parent, i, subtree_end[i], entry.start, depth[i]};
+        by_type[static_cast<size_t>(entry.node->type)].push_back(indexed);
+        if (entry.node->type == NodeType::CodeBlock && !entry.node->code_language.empty()) {
+            code_by_language[std::string(entry.node->code_language)].push_back(indexed);
+        }
     }
-    return cached_char_count_.value();
 }
 
-std::vector<Document::Link> Document::extract_links() const {
-    std::vector<Link> links;
+namespace {
+
+size_t count_lines(std::string_view text) {
+    if (text.empty()) {
+        return 0;
+    }
+    return std::count(text.begin(), text.end(), '\n') + (text.back() != '\n');
+}
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+} // namespace
+
+Document::StatsIndex::StatsIndex(const SourceIndex& index, std::string_view source) {
+    prefix.reserve(index.entries.size() + 1);
+    prefix.emplace_back();
     
-    visit([&links](const Node& node) {
-        if (node.type == NodeType::Link) {
-            Link link;
-            link.url = node.link_url;
-            link.position = node.source_start;
-            
-            // Extract link text from children
-            std::function<void(const Node&)> extract_text = [&link, &extract_text](const Node& n) {
-                if (n.type == NodeType::Text) {
-                    link.text += n.content;
-                }
-                for (const auto& child : n.children) {
-                    extract_text(*child);
+    std::vector<size_t> open_sections;
+    for (const auto& entry : index.entries) {
+        Stats running = prefix.back();
+        const Node& node = *entry.node;
+        switch (node.type) {
+            case NodeType::Text: {
+                auto counts = TextCounter::count(node.content);
+                running.words += counts.words;
+                running.characters += counts.characters;
+                if (entry.parent != SourceIndex::npos &&
+                    index.entries[entry.parent].node->type == NodeType::CodeBlock) {
+                    running.code_lines += count_lines(node.content);
                 }
-            };
-            
-            for (const auto& child : node.children) {
-                extract_text(*child);
+                break;
             }
-            
-            links.push_back(link);
+            case NodeType::Link:
+                ++running.links;
+                break;
+            case NodeType::Image:
+                ++running.images;
+                break;
+            case NodeType::Heading:
+                // A heading closes the open sections of its level and deeper
+                while (!open_sections.empty() &&
+                       sections[open_sections.back()].heading->heading_level >= node.heading_level) {
+                    sections[open_sections.back()].end = entry.start;
+                    open_sections.pop_back();
+                }
+                open_sections.push_back(sections.size());
+                sections.push_back({entry.start, source.size(), &node});
+                break;
+            default:
+                break;
         }
-    });
+        prefix.push_back(running);
+    }
     
-    return links;
+    for (size_t pos = source.find('\n'); pos != std::string_view::npos; pos = source.find('\n', pos + 1)) {
+        newlines.push_back(pos);
+    }
+    
+    total = prefix.back();
+    total.lines = count_lines(source);
 }
 
-void Document::visit(std::function<void(const Node&)> visitor) const {
-    if (root_) {
-        visit_impl(root_.get(), visitor);
+Document::Stats Document::StatsIndex::nodes_between(const SourceIndex& index, size_t begin, size_t end) const {
+    auto by_start = [](const SourceIndex::Entry& e, size_t offset) { return e.start < offset; };
+    size_t first = std::lower_bound(index.entries.begin(), index.entries.end(), begin, by_start) - index.entries.begin();
+    size_t last = std::lower_bound(index.entries.begin(), index.entries.end(), end, by_start) - index.entries.begin();
+    
+    Stats stats;
+    if (first < last) {
+        stats.words = prefix[last].words - prefix[first].words;
+        stats.characters = prefix[last].characters - prefix[first].characters;
+        stats.code_lines = prefix[last].code_lines - prefix[first].code_lines;
+        stats.links = prefix[last].links - prefix[first].links;
+        stats.images = prefix[last].images - prefix[first].images;
     }
+    return stats;
 }
 
-void Document::visit_impl(const Node* node, std::function<void(const Node&)>& visitor) const {
-    visitor(*node);
-    for (const auto& child : node->children) {
-        visit_impl(child.get(), visitor);
+size_t Document::StatsIndex::lines_between(size_t begin, size_t end) const {
+    if (begin >= end) {
+        return 0;
     }
+    // Line of an offset = newlines before it
+    auto line_of = [this](size_t offset) {
+        return std::lower_bound(newlines.begin(), newlines.end(), offset) - newlines.begin();
+    };
+    return line_of(end - 1) - line_of(begin) + 1;
 }
 
-size_t Document::count_words_simd(std::string_view text) const {
-    size_t word_count = 0;
-    bool in_word = false;
+void Document::NodeDeleter::operator()(Node* node) const {
+    if (!node || node->arena_allocated) {
+        return;
+    }
+    if (node->children.empty()) {
+        delete node;
+        return;
+    }
     
-    #ifdef __AVX2__
-    const __m256i space = _mm256_set1_epi8(' ');
-    const __m256i tab = _mm256_set1_epi8('\t');
-    const __m256i newline = _mm256_set1_epi8('\n');
-    const __m256i cr = _mm256_set1_epi8('\r');
+    // Children are detached before their parent goes, so no destructor
+    // ever has more than one level below it
+    std::vector<Node*> pending{node};
+    while (!pending.empty()) {
+        Node* current = pending.back();
+        pending.pop_back();
+        for (auto& child : current->children) {
+            Node* detached = child.release();
+            if (detached && !detached->arena_allocated) {
+                pending.push_back(detached);
+            }
+        }
+        delete current;
+    }
+}
+
+Document::Document() = default;
+
+Document::Document(std::pmr::memory_resource* upstream, size_t size_hint)
+    : arena_(std::make_unique<std::pmr::monotonic_buffer_resource>(
+          std::max<size_t>(size_hint, 4096), upstream)) {}
+
+Document::~Document() = default;
+
+Document::NodePtr Document::create_node(NodeType type) {
+    if (!arena_) {
+        return NodePtr(new Node(type));
+    }
     
-    size_t i = 0;
-    const size_t simd_width = 32;
+    void* storage = arena_->allocate(sizeof(Node), alignof(Node));
+    auto* node = new (storage) Node(type, Node::allocator_type(arena_.get()));
+    node->arena_allocated = true;
+    return NodePtr(node);
+}
+
+void Document::TableOfContents::generate(const Node* root) {
+    entries.clear();
+    if (!root) {
+        return;
+    }
     
-    while (i + simd_width <= text.size()) {
-        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + i));
-        
-        __m256i is_space = _mm256_cmpeq_epi8(chunk, space);
-        __m256i is_tab = _mm256_cmpeq_epi8(chunk, tab);
-        __m256i is_newline = _mm256_cmpeq_epi8(chunk, newline);
-        __m256i is_cr = _mm256_cmpeq_epi8(chunk, cr);
-        
-        __m256i is_whitespace = _mm256_or_si256(
-            _mm256_or_si256(is_space, is_tab),
-            _mm256_or_si256(is_newline, is_cr)
-        );
-        
-        uint32_t whitespace_mask = _mm256_movemask_epi8(is_whitespace);
+    // Headings that can still take subheadings, innermost last, with the
+    // list their subheadings go into. Entries are only appended to a list
+    // after every deeper heading in it was closed, so the pointers hold.
+    struct Open {
+        Entry* entry;
+        std::vector<Entry>* children;
+    };
+    std::vector<Open> open;
+    Slugger slugger;
+    std::vector<const Node*> pending{root};
+    size_t node_index = 0;
+    while (!pending.empty()) {
+        const Node* node = pending.back();
+        pending.pop_back();
         
-        for (size_t j = 0; j < simd_width; ++j) {
-            bool is_ws = (whitespace_mask >> j) & 1;
+        if (node->type == NodeType::Heading && node->heading_level > 0) {
+            while (!open.empty() && open.back().entry->level >= node->heading_level) {
+                open.back().entry->section_end = node->source_start;
+                open.pop_back();
+            }
+            auto& siblings = open.empty() ? entries : *open.back().children;
+            Entry& entry = siblings.emplace_back();
+            entry.level = node->heading_level;
+            entry.node_index = node_index;
+            entry.position = node->source_start;
             
-            if (is_ws) {
-                if (in_word) {
-                    word_count++;
-                    in_word = false;
+            // Heading text lives in Text nodes under the inline markup
+            for (const Node& inline_node : preorder(node)) {
+                if (inline_node.type == NodeType::Text) {
+                    entry.text += inline_node.content;
                 }
-            } else {
-                in_word = true;
             }
+            entry.slug = slugger.slug(entry.text);
+            open.push_back({&entry, &entry.children});
         }
+        ++node_index;
         
-        i += simd_width;
+        for (auto it = node->children.rbegin(); it != node->children.rend(); ++it) {
+            pending.push_back(it->get());
+        }
+    }
+    for (const auto& still_open : open) {
+        still_open.entry->section_end = std::max(root->source_end, still_open.entry->position);
     }
+}
+
+void Document::regenerate_toc() {
+    toc_.generate(root_.get());
     
-    // Handle remaining bytes
-    for (; i < text.size(); ++i) {
-        char c = text[i];
-        bool is_ws = (c == ' ' || c == '\t' || c == '\n' || c == '\r');
-        
-        if (is_ws) {
-            if (in_word) {
-                word_count++;
-                in_word = false;
-            }
+    anchors_.clear();
+    anchors_.reserve(toc_.entries.size());
+    std::vector<const TableOfContents::Entry*> pending;
+    for (auto it = toc_.entries.rbegin(); it != toc_.entries.rend(); ++it) {
+        pending.push_back(&*it);
+    }
+    while (!pending.empty()) {
+        const auto* entry = pending.back();
+        pending.pop_back();
+        anchors_.emplace(entry->slug, Anchor{entry->node_index, entry->position, entry->section_end, entry->level});
+        for (auto it = entry->children.rbegin(); it != entry->children.rend(); ++it) {
+            pending.push_back(&*it);
+        }
+    }
+}
+
+const Document::Anchor* Document::find_anchor(std::string_view fragment) const {
+    if (!fragment.empty() && fragment.front() == '#') {
+        fragment.remove_prefix(1);
+    }
+    
+    std::string decoded;
+    decoded.reserve(fragment.size());
+    for (size_t pos = 0; pos < fragment.size(); ++pos) {
+        if (fragment[pos] == '%' && pos + 2 < fragment.size() && hex_value(fragment[pos + 1]) >= 0 &&
+            hex_value(fragment[pos + 2]) >= 0) {
+            decoded += static_cast<char>(hex_value(fragment[pos + 1]) * 16 + hex_value(fragment[pos + 2]));
+            pos += 2;
         } else {
-            in_word = true;
+            decoded += fragment[pos];
         }
     }
-    #else
-    // Fallback non-SIMD implementation
-    for (char c : text) {
-        bool is_ws = (c == ' ' || c == '\t' || c == '\n' || c == '\r');
-        
-        if (is_ws) {
-            if (in_word) {
-                word_count++;
-                in_word = false;
+    
+    // An anchor as written, or else heading text to slug
+    auto found = anchors_.find(decoded);
+    if (found == anchors_.end()) {
+        found = anchors_.find(Slugger::slugify(decoded));
+    }
+    return found == anchors_.end() ? nullptr : &found->second;
+}
+
+std::string_view Document::section_source(const Anchor& anchor) const {
+    size_t begin = std::min(anchor.position, source_.size());
+    size_t end = std::clamp(anchor.section_end, begin, source_.size());
+    return source_.substr(begin, end - begin);
+}
+
+void Document::set_source(std::string_view source, std::shared_ptr<const void> owner) {
+    if (owner) {
+        source_owner_ = std::move(owner);
+        source_ = source;
+    } else {
+        source_owner_.reset();
+        source_ = store_text(source);
+    }
+    stats_index_.reset();
+    offset_map_.reset();
+}
+
+std::string_view Document::store_text(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    
+    if (!arena_) {
+        return heap_text_.emplace_back(text);
+    }
+    
+    auto* storage = static_cast<char*>(arena_->allocate(text.size(), 1));
+    std::copy(text.begin(), text.end(), storage);
+    return std::string_view(storage, text.size());
+}
+
+void Document::set_root(NodePtr root) {
+    root_ = std::move(root);
+    mark_modified();
+}
+
+void Document::mark_modified() {
+    source_index_.reset();
+    stats_index_.reset();
+    type_index_.reset();
+}
+
+void Document::clear() {
+    // Nodes first, while the arena they live in is still intact
+    root_.reset();
+    toc_.entries.clear();
+    anchors_.clear();
+    mark_modified();
+    
+    source_ = {};
+    source_owner_.reset();
+    offset_map_.reset();
+    heap_text_.clear();
+    parts_.clear();
+    shared_.clear();
+    shared_depth_ = 0;
+    replaced_bytes_ = 0;
+    has_link_definitions_ = false;
+    if (arena_) {
+        arena_->release();
+    }
+}
+
+void Document::adopt(std::unique_ptr<Document> part) {
+    if (part) {
+        parts_.push_back(std::move(part));
+    }
+}
+
+void Document::share(std::shared_ptr<const Document> base) {
+    if (base) {
+        shared_depth_ = std::max(shared_depth_, base->shared_depth() + 1);
+        shared_.push_back(std::move(base));
+    }
+}
+
+std::vector<Document::Link> Document::extract_links() const {
+    std::vector<Link> links;
+    
+    auto indexed = nodes_of_type(NodeType::Link);
+    links.reserve(indexed.size());
+    for (const auto& entry : indexed) {
+        Link& link = links.emplace_back();
+        link.url = entry.node->link_url;
+        link.position = entry.node->source_start;
+        for (const Node& inner : preorder(entry.node)) {
+            if (inner.type == NodeType::Text) {
+                link.text += inner.content;
             }
-        } else {
-            in_word = true;
         }
     }
-    #endif
     
-    if (in_word) {
-        word_count++;
+    return links;
+}
+
+const Document::SourceIndex& Document::source_index() const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    return source_index_locked();
+}
+
+// For callers already holding index_mutex_
+const Document::SourceIndex& Document::source_index_locked() const {
+    if (!source_index_) {
+        source_index_ = std::make_unique<SourceIndex>(root_.get());
+    }
+    return *source_index_;
+}
+
+const Document::StatsIndex& Document::stats_index() const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (!stats_index_) {
+        stats_index_ = std::make_unique<StatsIndex>(source_index_locked(), source_);
+    }
+    return *stats_index_;
+}
+
+const Document::TypeIndex& Document::type_index() const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (!type_index_) {
+        type_index_ = std::make_unique<TypeIndex>(source_index_locked());
+    }
+    return *type_index_;
+}
+
+const TextOffsetMap& Document::offset_map() const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (!offset_map_) {
+        offset_map_ = std::make_unique<TextOffsetMap>(source_);
+    }
+    return *offset_map_;
+}
+
+void Document::carry_offset_map(const Document& base, size_t offset, size_t removed_len, size_t inserted_len) {
+    std::unique_ptr<TextOffsetMap> map;
+    {
+        std::lock_guard<std::mutex> lock(base.index_mutex_);
+        if (!base.offset_map_) {
+            return;
+        }
+        map = std::make_unique<TextOffsetMap>(*base.offset_map_);
+    }
+    map->update(source_, offset, removed_len, inserted_len);
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    offset_map_ = std::move(map);
+}
+
+size_t Document::Stats::reading_minutes(size_t words_per_minute) const {
+    if (words_per_minute == 0) {
+        return 0;
+    }
+    return (words + words_per_minute - 1) / words_per_minute;
+}
+
+const Document::Stats& Document::stats() const {
+    return stats_index().total;
+}
+
+Document::Stats Document::stats_in_range(size_t begin, size_t end) const {
+    end = std::min(end, source_.size());
+    if (begin >= end) {
+        return {};
+    }
+    const StatsIndex& index = stats_index();
+    Stats stats = index.nodes_between(source_index(), begin, end);
+    stats.lines = index.lines_between(begin, end);
+    return stats;
+}
+
+Document::Stats Document::section_stats(const Node* heading) const {
+    const StatsIndex& index = stats_index();
+    if (!heading) {
+        return {};
+    }
+    // Sections are in source order. The index may have clamped the
+    // heading's start, so look around where it should be first.
+    auto it = std::lower_bound(index.sections.begin(), index.sections.end(), heading->source_start,
+                               [](const StatsIndex::Section& s, size_t offset) { return s.start < offset; });
+    for (; it != index.sections.end() && it->start == heading->source_start; ++it) {
+        if (it->heading == heading) {
+            return stats_in_range(it->start, it->end);
+        }
+    }
+    for (const auto& section : index.sections) {
+        if (section.heading == heading) {
+            return stats_in_range(section.start, section.end);
+        }
+    }
+    return {};
+}
+
+const Document::Node* Document::node_at_offset(size_t offset) const {
+    const SourceIndex& index = source_index();
+    size_t entry = index.innermost(offset);
+    return entry == SourceIndex::npos ? nullptr : index.entries[entry].node;
+}
+
+std::vector<const Document::Node*> Document::nodes_in_range(size_t begin, size_t end) const {
+    std::vector<const Node*> nodes;
+    if (begin >= end) {
+        return nodes;
+    }
+    
+    // Everything covering `begin` is an ancestor of the innermost node there
+    const SourceIndex& index = source_index();
+    for (size_t entry = index.innermost(begin); entry != SourceIndex::npos;
+         entry = index.entries[entry].parent) {
+        nodes.push_back(index.entries[entry].node);
     }
+    std::reverse(nodes.begin(), nodes.end());
     
-    return word_count;
+    // ...and the rest start inside the range
+    auto it = std::upper_bound(index.entries.begin(), index.entries.end(), begin,
+                               [](size_t offset, const SourceIndex::Entry& e) { return offset < e.start; });
+    for (; it != index.entries.end() && it->start < end; ++it) {
+        if (it->end > it->start) {
+            nodes.push_back(it->node);
+        }
+    }
+    return nodes;
+}
+
+std::span<const Document::IndexedNode> Document::nodes_of_type(NodeType type) const {
+    return type_index().by_type[static_cast<size_t>(type)];
+}
+
+std::span<const Document::IndexedNode> Document::nodes_of_type(NodeType type, size_t begin, size_t end) const {
+    auto nodes = nodes_of_type(type);
+    if (begin >= end) {
+        return {};
+    }
+    auto by_start = [](const IndexedNode& node, size_t offset) { return node.start < offset; };
+    auto first = std::lower_bound(nodes.begin(), nodes.end(), begin, by_start);
+    auto last = std::lower_bound(first, nodes.end(), end, by_start);
+    return {first, last};
+}
+
+std::span<const Document::IndexedNode> Document::nodes_of_type(NodeType type, const Anchor& section) const {
+    return nodes_of_type(type, section.position, section.section_end);
+}
+
+std::span<const Document::IndexedNode> Document::nodes_of_type(NodeType type, const IndexedNode& ancestor) const {
+    auto nodes = nodes_of_type(type);
+    auto by_index = [](const IndexedNode& node, size_t index) { return node.index < index; };
+    auto first = std::lower_bound(nodes.begin(), nodes.end(), ancestor.index + 1, by_index);
+    auto last = std::lower_bound(first, nodes.end(), ancestor.subtree_end, by_index);
+    return {first, last};
+}
+
+std::span<const Document::IndexedNode> Document::code_blocks(std::string_view language) const {
+    const auto& by_language = type_index().code_by_language;
+    auto found = by_language.find(std::string(language));
+    if (found == by_language.end()) {
+        return {};
+    }
+    return found->second;
+}
+
+void Document::visit(std::function<void(const Node&)> visitor) const {
+    walk(root_.get(), visitor);
 }
 
 } // namespace mdviewer
\ No newline at end of file
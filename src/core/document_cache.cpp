@@ -0,0 +1,385 @@
+#include "core/document_cache.h"
+#include "core/mapped_file.h"
+#include "utils/file_utils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace mdviewer {
+
+namespace {
+
+constexpr char kMagic[8] = {'I', 'N', 'K', 'W', 'D', 'O', 'C', '\0'};
+// Written as a native integer; entries from a machine with the other byte
+// order read back as a different value and are rejected
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+constexpr uint32_t kHasLinkDefinitions = 1;
+
+constexpr uint8_t kContentInPool = 1;
+constexpr uint8_t kListOrdered = 2;
+constexpr uint8_t kHasAttributes = 4;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t options;
+    uint32_t flags;
+    uint64_t source_size;
+    uint64_t source_hash;
+    uint64_t node_count;
+    uint64_t attribute_count;
+    uint64_t pool_size;
+    uint64_t checksum;  // of the rest of the header and everything after it
+};
+
+// Nodes in pre-order; each is followed by its `child_count` subtrees
+struct NodeRecord {
+    uint8_t type;
+    uint8_t flags;
+    uint8_t heading_level;
+    uint8_t reserved;
+    int32_t list_start;
+    uint32_t child_count;
+    uint32_t content_length;
+    uint64_t content_offset;  // into the source, or the pool with kContentInPool
+    uint64_t source_start;
+    uint64_t source_end;
+};
+
+// Metadata strings of the nodes flagged kHasAttributes, in node order and
+// stored back to back in the pool
+struct AttributeRecord {
+    uint64_t pool_offset;
+    uint32_t node_index;
+    uint32_t language_length;
+    uint32_t url_length;
+    uint32_t alt_length;
+};
+
+static_assert(sizeof(Header) == 72 && sizeof(NodeRecord) == 40 && sizeof(AttributeRecord) == 24,
+              "cache records must keep their on-disk size");
+static_assert(std::is_trivially_copyable_v<NodeRecord> && std::is_trivially_copyable_v<AttributeRecord>);
+
+constexpr auto kLastNodeType = Document::NodeType::Strikethrough;
+
+// What a loaded Document's source owner has to keep alive
+struct Backing {
+    std::shared_ptr<const void> source_owner;
+    std::shared_ptr<const MappedFile> entry;
+};
+
+bool in_range(uint64_t offset, uint64_t length, uint64_t size) {
+    return offset <= size && length <= size - offset;
+}
+
+uint64_t checksum(Header header, std::string_view payload) {
+    header.checksum = 0;
+    uint64_t seed = DocumentCache::hash({reinterpret_cast<const char*>(&header), sizeof(header)});
+    return DocumentCache::hash(payload, seed);
+}
+
+} // namespace
+
+uint64_t DocumentCache::hash(std::string_view data, uint64_t seed) {
+    constexpr uint64_t m = 0xc6a4a7935bd1e995ULL;
+    constexpr int r = 47;
+    
+    uint64_t h = seed ^ (data.size() * m);
+    const char* bytes = data.data();
+    size_t blocks = data.size() / 8;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint64_t k;
+        std::memcpy(&k, bytes + i * 8, 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    
+    size_t tail = data.size() & 7;
+    if (tail) {
+        uint64_t k = 0;
+        for (size_t i = 0; i < tail; ++i) {
+            k |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[blocks * 8 + i])) << (8 * i);
+        }
+        h ^= k;
+        h *= m;
+    }
+    
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+std::filesystem::path DocumentCache::entry_path(const std::filesystem::path& markdown_path) {
+    std::error_code error;
+    auto absolute = std::filesystem::absolute(markdown_path, error);
+    const std::string& key = error ? markdown_path.native() : absolute.native();
+    
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.inkdoc", static_cast<unsigned long long>(hash(key)));
+    return FileUtils::get_user_cache_directory() / "documents" / name;
+}
+
+bool DocumentCache::store(const std::filesystem::path& markdown_path, const Document& document, uint32_t options) {
+    auto entry = entry_path(markdown_path);
+    if (!FileUtils::create_directories(entry.parent_path()) && !FileUtils::is_directory(entry.parent_path())) {
+        return false;
+    }
+    return write_entry(entry, document, options);
+}
+
+std::unique_ptr<Document> DocumentCache::load(const std::filesystem::path& markdown_path,
+                                              std::string_view source, std::shared_ptr<const void> owner,
+                                              uint32_t options, std::pmr::memory_resource* memory) {
+    return read_entry(entry_path(markdown_path), source, std::move(owner), options, memory);
+}
+
+bool DocumentCache::write_entry(const std::filesystem::path& entry, const Document& document, uint32_t options) {
+    const Document::Node* root = document.get_root();
+    if (!root) {
+        return false;
+    }
+    
+    std::string_view source = document.source();
+    std::vector<NodeRecord> nodes;
+    std::vector<AttributeRecord> attributes;
+    std::string pool;
+    constexpr uint64_t max_length = std::numeric_limits<uint32_t>::max();
+    
+    std::vector<const Document::Node*> pending{root};
+    while (!pending.empty()) {
+        const Document::Node* node = pending.back();
+        pending.pop_back();
+        
+        NodeRecord record{};
+        record.type = static_cast<uint8_t>(node->type);
+        record.heading_level = static_cast<uint8_t>(std::clamp(node->heading_level, 0, 255));
+        record.list_start = node->list_start;
+        record.child_count = static_cast<uint32_t>(node->children.size());
+        record.source_start = node->source_start;
+        record.source_end = node->source_end;
+        if (node->list_ordered) {
+            record.flags |= kListOrdered;
+        }
+        
+        std::string_view content = node->content;
+        if (content.size() > max_length || node->children.size() > max_length) {
+            return false;
+        }
+        record.content_length = static_cast<uint32_t>(content.size());
+        if (!content.empty() && content.data() >= source.data() &&
+            content.data() + content.size() <= source.data() + source.size()) {
+            record.content_offset = content.data() - source.data();
+        } else if (!content.empty()) {
+            record.flags |= kContentInPool;
+            record.content_offset = pool.size();
+            pool.append(content);
+        }
+        
+        if (!node->code_language.empty() || !node->link_url.empty() || !node->image_alt.empty()) {
+            if (node->code_language.size() > max_length || node->link_url.size() > max_length ||
+                node->image_alt.size() > max_length) {
+                return false;
+            }
+            record.flags |= kHasAttributes;
+            attributes.push_back({pool.size(), static_cast<uint32_t>(nodes.size()),
+                                  static_cast<uint32_t>(node->code_language.size()),
+                                  static_cast<uint32_t>(node->link_url.size()),
+                                  static_cast<uint32_t>(node->image_alt.size())});
+            pool.append(node->code_language);
+            pool.append(node->link_url);
+            pool.append(node->image_alt);
+        }
+        nodes.push_back(record);
+        
+        for (auto it = node->children.rbegin(); it != node->children.rend(); ++it) {
+            pending.push_back(it->get());
+        }
+    }
+    
+    std::string payload;
+    payload.reserve(nodes.size() * sizeof(NodeRecord) + attributes.size() * sizeof(AttributeRecord) + pool.size());
+    payload.append(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(NodeRecord));
+    payload.append(reinterpret_cast<const char*>(attributes.data()), attributes.size() * sizeof(AttributeRecord));
+    payload.append(pool);
+    
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = format_version;
+    header.byte_order = kByteOrderMark;
+    header.options = options;
+    header.flags = document.has_link_definitions() ? kHasLinkDefinitions : 0;
+    header.source_size = source.size();
+    header.source_hash = hash(source);
+    header.node_count = nodes.size();
+    header.attribute_count = attributes.size();
+    header.pool_size = pool.size();
+    header.checksum = checksum(header, payload);
+    
+    // Written aside and renamed into place, so a reader never maps a
+    // half-written entry
+    auto temporary = entry;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        if (!file.good()) {
+            file.close();
+            std::error_code ignored;
+            std::filesystem::remove(temporary, ignored);
+            return false;
+        }
+    }
+    
+    std::error_code error;
+    std::filesystem::rename(temporary, entry, error);
+    return !error;
+}
+
+std::unique_ptr<Document> DocumentCache::read_entry(const std::filesystem::path& entry,
+                                                    std::string_view source, std::shared_ptr<const void> owner,
+                                                    uint32_t options, std::pmr::memory_resource* memory) {
+    auto mapping = MappedFile::open(entry);
+    if (!mapping) {
+        return nullptr;
+    }
+    std::string_view bytes = mapping->bytes();
+    
+    Header header;
+    if (bytes.size() < sizeof(header)) {
+        return nullptr;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != format_version ||
+        header.byte_order != kByteOrderMark || header.options != options ||
+        header.source_size != source.size() || header.node_count == 0 ||
+        (header.flags & ~kHasLinkDefinitions) != 0) {
+        return nullptr;
+    }
+    
+    std::string_view payload = bytes.substr(sizeof(header));
+    if (header.node_count > payload.size() / sizeof(NodeRecord) ||
+        header.attribute_count > payload.size() / sizeof(AttributeRecord) ||
+        header.node_count * sizeof(NodeRecord) + header.attribute_count * sizeof(AttributeRecord) +
+            header.pool_size != payload.size() ||
+        checksum(header, payload) != header.checksum || hash(source) != header.source_hash) {
+        return nullptr;
+    }
+    
+    // MappedFile's bytes are aligned and every table is a multiple of 8 bytes
+    const auto* records = reinterpret_cast<const NodeRecord*>(payload.data());
+    const auto* attribute_records = reinterpret_cast<const AttributeRecord*>(records + header.node_count);
+    std::string_view pool = payload.substr(payload.size() - header.pool_size);
+    
+    if (!owner) {
+        auto copy = std::make_shared<std::string>(source);
+        source = *copy;
+        owner = std::move(copy);
+    }
+    
+    auto document = std::make_unique<Document>(memory, header.node_count * (sizeof(Document::Node) + sizeof(Document::NodePtr)));
+    document->set_source(source, std::make_shared<Backing>(Backing{std::move(owner), mapping}));
+    
+    // Rebuilds the tree from the pre-order table, tracking how many
+    // children each open node is still owed
+    auto make_node = [&](uint64_t index) -> Document::NodePtr {
+        const NodeRecord& record = records[index];
+        // Each child is one of the nodes after this one, so a larger count
+        // is corrupt and mustn't reach reserve()
+        if (record.type > static_cast<uint8_t>(kLastNodeType) || record.source_start > record.source_end ||
+            record.source_end > source.size() || record.child_count > header.node_count - index - 1) {
+            return nullptr;
+        }
+        
+        auto node = document->create_node(static_cast<Document::NodeType>(record.type));
+        node->heading_level = record.heading_level;
+        node->list_start = record.list_start;
+        node->list_ordered = (record.flags & kListOrdered) != 0;
+        node->source_start = record.source_start;
+        node->source_end = record.source_end;
+        node->children.reserve(record.child_count);
+        
+        std::string_view text = (record.flags & kContentInPool) ? pool : source;
+        if (!in_range(record.content_offset, record.content_length, text.size())) {
+            return nullptr;
+        }
+        node->content = text.substr(record.content_offset, record.content_length);
+        return node;
+    };
+    
+    uint64_t next_attribute = 0;
+    auto read_attributes = [&](uint64_t index, Document::Node& node) {
+        if (!(records[index].flags & kHasAttributes)) {
+            return true;
+        }
+        if (next_attribute == header.attribute_count) {
+            return false;
+        }
+        
+        const AttributeRecord& attribute = attribute_records[next_attribute++];
+        uint64_t total = uint64_t{attribute.language_length} + attribute.url_length + attribute.alt_length;
+        if (attribute.node_index != index || !in_range(attribute.pool_offset, total, pool.size())) {
+            return false;
+        }
+        std::string_view strings = pool.substr(attribute.pool_offset, total);
+        node.code_language = strings.substr(0, attribute.language_length);
+        node.link_url = strings.substr(attribute.language_length, attribute.url_length);
+        node.image_alt = strings.substr(attribute.language_length + attribute.url_length);
+        return true;
+    };
+    
+    auto root = make_node(0);
+    if (!root || !read_attributes(0, *root)) {
+        return nullptr;
+    }
+    std::vector<std::pair<Document::Node*, uint32_t>> open;
+    if (records[0].child_count > 0) {
+        open.emplace_back(root.get(), records[0].child_count);
+    }
+    
+    for (uint64_t index = 1; index < header.node_count; ++index) {
+        if (open.empty()) {
+            return nullptr;
+        }
+        auto& [parent, owed] = open.back();
+        Document::Node* parent_node = parent;
+        if (--owed == 0) {
+            open.pop_back();
+        }
+        
+        auto node = make_node(index);
+        if (!node || !read_attributes(index, *node)) {
+            return nullptr;
+        }
+        Document::Node* raw = node.get();
+        parent_node->children.push_back(std::move(node));
+        if (records[index].child_count > 0) {
+            open.emplace_back(raw, records[index].child_count);
+        }
+    }
+    if (!open.empty() || next_attribute != header.attribute_count) {
+        return nullptr;
+    }
+    
+    document->set_has_link_definitions((header.flags & kHasLinkDefinitions) != 0);
+    document->set_root(std::move(root));
+    document->regenerate_toc();
+    return document;
+}
+
+} // namespace mdviewer
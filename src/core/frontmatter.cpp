@@ -0,0 +1,201 @@
+#include "core/frontmatter.h"
+#include <algorithm>
+#include <fstream>
+
+namespace mdviewer {
+
+namespace {
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && is_space(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && is_space(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+std::string_view unquote(std::string_view value) {
+    if (value.size() >= 2 && (value.front() == '"' || value.front() == '\'') && value.back() == value.front()) {
+        return value.substr(1, value.size() - 2);
+    }
+    return value;
+}
+
+// Drops a trailing " # comment" from an unquoted scalar
+std::string_view strip_comment(std::string_view value) {
+    if (value.empty() || value.front() == '"' || value.front() == '\'') {
+        return value;
+    }
+    size_t comment = value.find(" #");
+    return comment == std::string_view::npos ? value : trim(value.substr(0, comment));
+}
+
+bool is_list_item(std::string_view content) {
+    return !content.empty() && content[0] == '-' && (content.size() == 1 || content[1] == ' ');
+}
+
+// Items of an inline "[a, 'b, c', d]" list
+std::vector<std::string_view> split_inline_list(std::string_view list) {
+    std::vector<std::string_view> items;
+    std::string_view inner = list.substr(1, list.size() - 2);
+    char quote = '\0';
+    size_t item_start = 0;
+    for (size_t i = 0; i <= inner.size(); ++i) {
+        if (i < inner.size() && quote != '\0') {
+            if (inner[i] == quote) {
+                quote = '\0';
+            }
+        } else if (i < inner.size() && (inner[i] == '"' || inner[i] == '\'')) {
+            quote = inner[i];
+        } else if (i == inner.size() || inner[i] == ',') {
+            std::string_view item = unquote(trim(inner.substr(item_start, i - item_start)));
+            if (!item.empty()) {
+                items.push_back(item);
+            }
+            item_start = i + 1;
+        }
+    }
+    return items;
+}
+
+} // namespace
+
+Frontmatter Frontmatter::split(std::string_view text) {
+    Frontmatter result;
+    result.body_ = text;
+    
+    size_t start = text.substr(0, 3) == "\xEF\xBB\xBF" ? 3 : 0;
+    size_t first_end = text.find('\n', start);
+    if (first_end == std::string_view::npos || trim(text.substr(start, first_end - start)) != "---") {
+        return result;
+    }
+    
+    size_t yaml_start = first_end + 1;
+    for (size_t line = yaml_start; line < text.size();) {
+        size_t end = std::min(text.find('\n', line), text.size());
+        std::string_view content = trim(text.substr(line, end - line));
+        if (content == "---" || content == "...") {
+            result.present_ = true;
+            result.yaml_ = text.substr(yaml_start, line - yaml_start);
+            result.body_offset_ = std::min(end + 1, text.size());
+            result.body_ = text.substr(result.body_offset_);
+            return result;
+        }
+        line = end + 1;
+    }
+    return result;
+}
+
+std::optional<Frontmatter> Frontmatter::read_header(const std::filesystem::path& path, size_t max_bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    
+    auto buffer = std::make_shared<std::string>(max_bytes, '\0');
+    file.read(buffer->data(), static_cast<std::streamsize>(max_bytes));
+    buffer->resize(static_cast<size_t>(file.gcount()));
+    
+    // The string itself never moves, so views into it survive copies
+    Frontmatter result = split(*buffer);
+    result.storage_ = std::move(buffer);
+    return result;
+}
+
+const std::vector<Frontmatter::Entry>& Frontmatter::entries() const {
+    if (entries_) {
+        return *entries_;
+    }
+    entries_.emplace();
+    auto& entries = *entries_;
+    
+    constexpr size_t none = static_cast<size_t>(-1);
+    size_t open = none;          // entry that following lines may add to
+    size_t block_start = none;   // start of a | or > block for `open`
+    size_t block_end = 0;
+    auto close_block = [&] {
+        if (open != none && block_start != none) {
+            entries[open].value = yaml_.substr(block_start, block_end - block_start);
+        }
+        block_start = none;
+    };
+    
+    bool in_block = false;
+    for (size_t pos = 0; pos < yaml_.size();) {
+        size_t end = std::min(yaml_.find('\n', pos), yaml_.size());
+        std::string_view line = yaml_.substr(pos, end - pos);
+        std::string_view content = trim(line);
+        bool indented = !line.empty() && is_space(line[0]);
+        
+        if (in_block && (content.empty() || indented)) {
+            // Block scalar lines, blank ones included, until the indentation ends
+            if (!content.empty()) {
+                block_start = block_start == none ? pos : block_start;
+                block_end = end;
+            }
+        } else if (content.empty() || content[0] == '#') {
+            // Blank lines and comments
+        } else if (indented || is_list_item(content)) {
+            if (open != none && is_list_item(content)) {
+                std::string_view item = strip_comment(trim(content.substr(1)));
+                entries[open].items.push_back(unquote(item));
+            }
+        } else {
+            close_block();
+            in_block = false;
+            open = none;
+            
+            size_t colon = content.find(':');
+            if (colon != std::string_view::npos) {
+                Entry entry;
+                entry.key = unquote(trim(content.substr(0, colon)));
+                std::string_view value = trim(content.substr(colon + 1));
+                if (!value.empty() && (value[0] == '|' || value[0] == '>')) {
+                    in_block = true;
+                } else if (value.size() >= 2 && value.front() == '[' && value.back() == ']') {
+                    entry.items = split_inline_list(value);
+                } else {
+                    entry.value = unquote(strip_comment(value));
+                }
+                entries.push_back(std::move(entry));
+                open = entries.size() - 1;
+            }
+        }
+        pos = end + 1;
+    }
+    close_block();
+    return entries;
+}
+
+const Frontmatter::Entry* Frontmatter::find(std::string_view key) const {
+    const auto& all = entries();
+    auto it = std::find_if(all.begin(), all.end(), [key](const Entry& entry) { return entry.key == key; });
+    return it == all.end() ? nullptr : &*it;
+}
+
+std::optional<std::string_view> Frontmatter::get(std::string_view key) const {
+    const Entry* entry = find(key);
+    if (!entry) {
+        return std::nullopt;
+    }
+    return entry->value;
+}
+
+std::vector<std::string_view> Frontmatter::get_list(std::string_view key) const {
+    const Entry* entry = find(key);
+    if (!entry) {
+        return {};
+    }
+    if (entry->items.empty() && !entry->value.empty()) {
+        return {entry->value};
+    }
+    return entry->items;
+}
+
+} // namespace mdviewer
@@ -0,0 +1,25 @@
+#include "core/latest_request.h"
+
+namespace mdviewer {
+
+uint64_t LatestRequest::supersede() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    token_.cancel();
+    token_ = CancellationToken();
+    return ++ticket_;
+}
+
+std::optional<CancellationToken> LatestRequest::start(uint64_t ticket) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ticket != ticket_) {
+        return std::nullopt;
+    }
+    return token_;
+}
+
+bool LatestRequest::is_current(uint64_t ticket) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ticket == ticket_;
+}
+
+} // namespace mdviewer
@@ -0,0 +1,125 @@
+#include "core/mapped_file.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mdviewer {
+
+namespace {
+
+// Closes the descriptor on every way out of open()
+class Descriptor {
+public:
+    explicit Descriptor(int fd) : fd_(fd) {}
+    ~Descriptor() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    Descriptor(const Descriptor&) = delete;
+    Descriptor& operator=(const Descriptor&) = delete;
+
+    int get() const { return fd_; }
+
+private:
+    int fd_;
+};
+
+std::error_code last_error() {
+    return {errno, std::generic_category()};
+}
+
+} // namespace
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::filesystem::path& path, std::error_code& error) {
+    return load(path, error, true);
+}
+
+std::shared_ptr<const MappedFile> MappedFile::read(const std::filesystem::path& path, std::error_code& error) {
+    return load(path, error, false);
+}
+
+std::shared_ptr<const MappedFile> MappedFile::load(const std::filesystem::path& path, std::error_code& error,
+                                                   bool allow_mapping) {
+    error.clear();
+    Descriptor fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    if (fd.get() < 0) {
+        error = last_error();
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd.get(), &info) != 0) {
+        error = last_error();
+        return nullptr;
+    }
+    if (S_ISDIR(info.st_mode)) {
+        error = std::make_error_code(std::errc::is_a_directory);
+        return nullptr;
+    }
+
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    const bool regular = S_ISREG(info.st_mode);
+    const size_t expected = regular ? static_cast<size_t>(info.st_size) : 0;
+
+    if (allow_mapping && regular && expected >= map_threshold) {
+        void* data = mmap(nullptr, expected, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+        if (data != MAP_FAILED) {
+            // The parser reads it once, front to back: start paging it all in now
+            madvise(data, expected, MADV_SEQUENTIAL);
+            madvise(data, expected, MADV_WILLNEED);
+            file->data_ = static_cast<const char*>(data);
+            file->size_ = expected;
+            file->mapped_ = true;
+            return file;
+        }
+    }
+
+    // One read for a regular file of known size; anything else grows the
+    // buffer until end of file
+    size_t capacity = regular ? expected + 1 : map_threshold;
+    std::unique_ptr<char[]> buffer(new char[capacity]);
+    size_t size = 0;
+    for (;;) {
+        if (size == capacity) {
+            capacity *= 2;
+            std::unique_ptr<char[]> grown(new char[capacity]);
+            std::memcpy(grown.get(), buffer.get(), size);
+            buffer = std::move(grown);
+        }
+        ssize_t count = ::read(fd.get(), buffer.get() + size, capacity - size);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error = last_error();
+            return nullptr;
+        }
+        if (count == 0) {
+            break;
+        }
+        size += static_cast<size_t>(count);
+    }
+
+    file->buffer_ = std::move(buffer);
+    file->data_ = file->buffer_.get();
+    file->size_ = size;
+    return file;
+}
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::filesystem::path& path) {
+    std::error_code error;
+    return open(path, error);
+}
+
+MappedFile::~MappedFile() {
+    if (mapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+} // namespace mdviewer
@@ -1,23 +1,23 @@
 #include "core/markdown_parser.h"
+#include "core/block_scanner.h"
+#include "core/structural_scanner.h"
+#include "utils/string_utils.h"
 #include <stack>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <thread>
+#include <unordered_map>
 #include <fmt/format.h>
-#ifdef __x86_64__
-#include <immintrin.h>
-#elif defined(__aarch64__)
-#include <arm_neon.h>
-#endif
 
 namespace mdviewer {
 
 class MarkdownParser::Impl {
 public:
     std::pmr::memory_resource* memory;
-    MD_PARSER parser;
     unsigned parser_flags = 0;
-    
-    std::stack<Document::Node*> node_stack;
-    std::unique_ptr<Document> current_document;
-    ParseCallback incremental_callback;
+    bool use_arena = true;
+    size_t parse_threads = 1;
     
     Impl(std::pmr::memory_resource* mem) : memory(mem) {
         parser_flags = MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | 
@@ -25,26 +25,392 @@ public:
     }
 };
 
+// Per-parse state handed to md4c as userdata
+class MarkdownParser::Builder {
+public:
+    Document& document;
+    std::string_view source;
+    std::stack<Document::Node*, std::vector<Document::Node*>> node_stack;
+    ParseCallback callback;
+    
+    // Consecutive text callbacks are merged into one Text node. While the
+    // fragments stay contiguous in the source the node is just a view;
+    // otherwise they are joined in run_copy and stored on flush.
+    Document::Node* open_text = nullptr;
+    const char* run_begin = nullptr;
+    const char* run_end = nullptr;
+    std::string run_copy;
+    bool run_copied = false;
+    // Decoded entities, which append_text copies
+    std::string entity_text;
+    // Where the "(...)" or "[...]" right after a "]" closes, keyed by the
+    // opener, for the source from destinations_from on. Found in one pass
+    // the first time a link asks, rather than scanned for once per link.
+    mutable std::unordered_map<size_t, size_t> destination_ends;
+    mutable size_t destinations_from = std::string_view::npos;
+    
+    // Source ranges. md4c reports no offsets, but text fragments point into
+    // the source, so blocks are located from where the previous block ended
+    // and spans from the text they enclose.
+    size_t run_source_start = 0;
+    size_t run_source_end = 0;
+    bool run_located = false;
+    size_t text_end = 0;      // end of the furthest text seen so far
+    size_t block_cursor = 0;  // end of the last block that was closed
+    size_t block_start = 0;   // start of the last block that was opened
+    
+    // Checked every check_interval callbacks; a callback returning nonzero
+    // makes md4c abort
+    static constexpr int check_interval = 32;
+    const Limits* limits = nullptr;
+    int until_check = check_interval;
+    ParseStatus status = ParseStatus::Complete;
+    
+    explicit Builder(Document& doc) : document(doc) {}
+    
+    bool should_stop() {
+        if (!limits || --until_check > 0) {
+            return false;
+        }
+        until_check = check_interval;
+        if (limits->token && limits->token->cancelled()) {
+            status = ParseStatus::Cancelled;
+        } else if (limits->deadline && std::chrono::steady_clock::now() >= *limits->deadline) {
+            status = ParseStatus::TimedOut;
+        }
+        return status != ParseStatus::Complete;
+    }
+    
+    bool in_source(std::string_view fragment) const {
+        return fragment.data() >= source.data() &&
+               fragment.data() + fragment.size() <= source.data() + source.size();
+    }
+    
+    // `origin` is the source text the fragment stands for, when that differs
+    // from the fragment itself (decoded entities)
+    void append_text(std::string_view fragment, std::string_view origin) {
+        if (in_source(origin)) {
+            size_t start = origin.data() - source.data();
+            size_t end = start + origin.size();
+            if (!open_text || !run_located) {
+                run_source_start = run_source_end = start;
+                run_located = true;
+            }
+            run_source_end = std::max(run_source_end, end);
+            text_end = std::max(text_end, end);
+        }
+        append_text(fragment);
+    }
+    
+    void append_text(std::string_view fragment) {
+        if (open_text) {
+            if (!run_copied) {
+                // md4c hands out line breaks as static "\n" strings; they still
+                // extend the view when the source holds the same bytes next
+                size_t remaining = source.data() + source.size() - run_end;
+                bool contiguous = fragment.data() == run_end ||
+                    (remaining >= fragment.size() &&
+                     std::equal(fragment.begin(), fragment.end(), run_end));
+                if (contiguous) {
+                    run_end += fragment.size();
+                    return;
+                }
+                run_copy.assign(run_begin, run_end);
+                run_copied = true;
+            }
+            run_copy.append(fragment);
+            return;
+        }
+        
+        auto node = document.create_node(Document::NodeType::Text);
+        open_text = node.get();
+        node_stack.top()->children.push_back(std::move(node));
+        if (!run_located) {
+            run_source_start = run_source_end = position();
+        }
+        
+        if (in_source(fragment)) {
+            run_begin = fragment.data();
+            run_end = run_begin + fragment.size();
+            run_copied = false;
+        } else {
+            run_copy.assign(fragment);
+            run_copied = true;
+        }
+    }
+    
+    void flush_text() {
+        if (!open_text) {
+            return;
+        }
+        
+        Document::Node* node = open_text;
+        open_text = nullptr;
+        node->content = run_copied
+            ? document.store_text(run_copy)
+            : std::string_view(run_begin, run_end - run_begin);
+        node->source_start = run_source_start;
+        node->source_end = run_source_end;
+        run_located = false;
+        
+        if (callback) {
+            callback(*node);
+        }
+    }
+    
+    Document::Node* push(Document::NodeType type) {
+        auto node = document.create_node(type);
+        Document::Node* raw = node.get();
+        node_stack.top()->children.push_back(std::move(node));
+        node_stack.push(raw);
+        return raw;
+    }
+    
+    // md4c still sends a leave callback for block/span types we don't model,
+    // so re-push the current parent to keep enter/leave balanced
+    void push_passthrough() {
+        node_stack.push(node_stack.top());
+    }
+    
+    void pop() {
+        // Never pop the document root
+        if (node_stack.size() > 1) {
+            node_stack.pop();
+        }
+    }
+    
+    // Start of the line after the one ending at `end`, or npos at the end
+    size_t next_line(size_t end) const {
+        return end < source.size() ? end + 1 : std::string_view::npos;
+    }
+    
+    // Line breaks arrive as static strings; the text after one is on the
+    // next line even if none of it reaches us (an empty link, say)
+    void note_line_break() {
+        text_end = std::min(BlockScanner::line_end(source, position()) + 1, source.size());
+    }
+    
+    // Where nodes without source text of their own (empty spans and cells,
+    // blank code lines) are placed: after any text of the current block
+    size_t position() const {
+        return std::max(text_end, block_start);
+    }
+    
+    // Blocks start at the first content after the previous block; table
+    // cells are located by their text instead, as they share a line
+    void begin_block(bool is_cell) {
+        Document::Node* node = node_stack.top();
+        node->source_start = is_cell ? position() : BlockScanner::skip_whitespace(source, block_cursor);
+        block_start = node->source_start;
+    }
+    
+    void end_block(MD_BLOCKTYPE type, void* detail) {
+        Document::Node* node = node_stack.top();
+        const auto& children = node->children;
+        
+        if (type == MD_BLOCK_TH || type == MD_BLOCK_TD) {
+            if (!children.empty()) {
+                node->source_start = children.front()->source_start;
+            }
+            node->source_end = children.empty() ? node->source_start : children.back()->source_end;
+            return;
+        }
+        
+        // Link reference definitions produce no events, so a paragraph may
+        // start later than the cursor suggests
+        if ((type == MD_BLOCK_P || type == MD_BLOCK_H) && !children.empty()) {
+            size_t first = children.front()->source_start;
+            size_t first_line = BlockScanner::line_start(source, first);
+            node->source_start = std::max(node->source_start, BlockScanner::skip_whitespace(source, first_line));
+        }
+        
+        // Blocks cover whole lines, up to the line holding their last text
+        size_t last = std::max(node->source_start, text_end);
+        size_t end = BlockScanner::line_end(source, last);
+        if (!children.empty()) {
+            end = std::max(end, children.back()->source_end);
+        }
+        
+        size_t next = next_line(end);
+        if (next != std::string_view::npos) {
+            if (type == MD_BLOCK_CODE) {
+                // Blank lines at the end of the code produce no source text
+                auto* code_detail = static_cast<MD_BLOCK_CODE_DETAIL*>(detail);
+                size_t fence = next;
+                while (fence < source.size() && BlockScanner::is_blank_line(source, fence)) {
+                    fence = BlockScanner::line_end(source, fence) + 1;
+                }
+                if (code_detail && code_detail->fence_char && fence < source.size() &&
+                    BlockScanner::is_closing_fence(source, fence, code_detail->fence_char)) {
+                    end = BlockScanner::line_end(source, fence);
+                }
+            } else if (type == MD_BLOCK_H) {
+                size_t marker = BlockScanner::skip_container_prefix(source, node->source_start);
+                bool atx = marker < source.size() && source[marker] == '#';
+                if (!atx && BlockScanner::is_setext_underline(source, next)) {
+                    end = BlockScanner::line_end(source, next);
+                }
+            } else if (type == MD_BLOCK_THEAD) {
+                // The delimiter row belongs to the header
+                end = BlockScanner::line_end(source, next);
+            }
+        }
+        
+        node->source_end = end;
+        block_cursor = end;
+    }
+    
+    // Spans cover their text plus the delimiters md4c strips from it
+    void end_span(MD_SPANTYPE type) {
+        switch (type) {
+            case MD_SPAN_EM:
+            case MD_SPAN_STRONG:
+            case MD_SPAN_DEL:
+            case MD_SPAN_CODE:
+            case MD_SPAN_A:
+            case MD_SPAN_IMG:
+                break;
+            default:
+                // Passthrough spans share their parent's node
+                return;
+        }
+        
+        Document::Node* node = node_stack.top();
+        const auto& children = node->children;
+        if (children.empty()) {
+            node->source_start = node->source_end = position();
+            return;
+        }
+        
+        size_t start = children.front()->source_start;
+        size_t end = children.back()->source_end;
+        auto widen = [&](std::string_view marks, size_t max_run) {
+            for (size_t n = 0; n < max_run && start > 0 &&
+                 marks.find(source[start - 1]) != std::string_view::npos; ++n) {
+                --start;
+            }
+            for (size_t n = 0; n < max_run && end < source.size() &&
+                 marks.find(source[end]) != std::string_view::npos; ++n) {
+                ++end;
+            }
+        };
+        
+        switch (type) {
+            case MD_SPAN_EM:
+                widen("*_", 1);
+                break;
+            case MD_SPAN_STRONG:
+                widen("*_", 2);
+                break;
+            case MD_SPAN_DEL:
+                widen("~", 2);
+                break;
+            case MD_SPAN_CODE:
+                // Code spans may pad their content with one space
+                if (start > 1 && source[start - 1] == ' ' && source[start - 2] == '`') {
+                    --start;
+                }
+                if (end + 1 < source.size() && source[end] == ' ' && source[end + 1] == '`') {
+                    ++end;
+                }
+                widen("`", source.size());
+                break;
+            case MD_SPAN_A:
+            case MD_SPAN_IMG:
+                if (start > 0 && source[start - 1] == '<' && end < source.size() && source[end] == '>') {
+                    --start;
+                    ++end;
+                    break;
+                }
+                if (start > 0 && source[start - 1] == '[') {
+                    --start;
+                    if (type == MD_SPAN_IMG && start > 0 && source[start - 1] == '!') {
+                        --start;
+                    }
+                }
+                if (end < source.size() && source[end] == ']') {
+                    ++end;
+                    end = link_destination_end(end);
+                }
+                break;
+            default:
+                break;
+        }
+        
+        node->source_start = start;
+        node->source_end = end;
+    }
+    
+    // Skips an inline "(destination)" or reference "[label]" after a link's
+    // closing bracket. Neither runs past a blank line, so an opener that
+    // never closes ends its search there.
+    size_t link_destination_end(size_t pos) const {
+        if (pos >= source.size() || (source[pos] != '(' && source[pos] != '[')) {
+            return pos;
+        }
+        if (pos < destinations_from) {
+            find_destination_ends(pos);
+        }
+        auto end = destination_ends.find(pos);
+        return end == destination_ends.end() ? pos : end->second;
+    }
+    
+    // Matches parentheses and brackets, each kind on its own, from `from` to
+    // the end of the source, keeping the pairs whose opener follows a "]"
+    void find_destination_ends(size_t from) const {
+        destination_ends.clear();
+        destinations_from = from;
+        std::vector<size_t> parens;
+        std::vector<size_t> brackets;
+        for (size_t i = from; i < source.size(); ++i) {
+            char c = source[i];
+            if (c == '\\') {
+                ++i;
+            } else if (c == '(' || c == '[') {
+                (c == '(' ? parens : brackets).push_back(i);
+            } else if ((c == ')' && !parens.empty()) || (c == ']' && !brackets.empty())) {
+                auto& open = c == ')' ? parens : brackets;
+                size_t opener = open.back();
+                open.pop_back();
+                if (opener > 0 && source[opener - 1] == ']') {
+                    destination_ends.emplace(opener, i + 1);
+                }
+            } else if (c == '\n' && (parens.size() | brackets.size()) != 0) {
+                size_t next = i + 1;
+                while (next < source.size() && (source[next] == ' ' || source[next] == '\t' || source[next] == '\r')) {
+                    ++next;
+                }
+                if (next == source.size() || source[next] == '\n') {
+                    parens.clear();
+                    brackets.clear();
+                }
+            }
+        }
+    }
+};
+
 MarkdownParser::MarkdownParser(std::pmr::memory_resource* memory)
     : impl_(std::make_unique<Impl>(memory)) {}
 
 MarkdownParser::~MarkdownParser() = default;
 
-std::unique_ptr<Document> MarkdownParser::parse(std::string_view input) {
-    impl_->current_document = std::make_unique<Document>();
-    
-    // Create a proper root node - this will be our document container
-    auto root = std::make_unique<Document::Node>(Document::NodeType::Paragraph);
-    
-    // Clear the stack before starting
-    while (!impl_->node_stack.empty()) {
-        impl_->node_stack.pop();
+std::unique_ptr<Document> MarkdownParser::make_document(std::pmr::memory_resource* memory, size_t size_hint) const {
+    if (!impl_->use_arena) {
+        return std::make_unique<Document>();
+    }
+    return std::make_unique<Document>(memory, size_hint);
+}
+
+std::unique_ptr<Document> MarkdownParser::make_document(size_t size_hint) const {
+    return make_document(impl_->memory, size_hint);
+}
+
+int MarkdownParser::run_md4c(Builder& builder, size_t begin) const {
+    std::string_view input = builder.source.substr(std::min(begin, builder.source.size()));
+    if (input.empty() || input.data() == nullptr) {
+        return 0;
     }
     
-    // Push the root node to the stack - this ensures stack is never empty during parsing
-    impl_->node_stack.push(root.get());
-    
-    // Set up the parser structure
     MD_PARSER parser = {
         0,
         impl_->parser_flags,
@@ -57,313 +423,698 @@ std::unique_ptr<Document> MarkdownParser::parse(std::string_view input) {
         nullptr
     };
     
-    // Parse the markdown if input is not empty
-    int result = 0;
-    if (!input.empty() && input.data() != nullptr) {
-        result = md_parse(input.data(), input.size(), &parser, impl_.get());
+    builder.block_cursor = builder.text_end = builder.block_start = begin;
+    int result = md_parse(input.data(), static_cast<MD_SIZE>(input.size()), &parser, &builder);
+    builder.flush_text();
+    return result;
+}
+
+std::unique_ptr<Document> MarkdownParser::parse(std::string_view input) {
+    return parse(input, impl_->memory);
+}
+
+std::unique_ptr<Document> MarkdownParser::parse(std::string_view input, std::pmr::memory_resource* memory) {
+    // A parallel parse builds its nodes in per-chunk Documents
+    auto document = make_document(memory, parse_threads_for(input) > 1 ? 0 : input.size());
+    document->set_source(input);
+    build(*document);
+    return document;
+}
+
+std::unique_ptr<Document> MarkdownParser::parse(std::string_view input, std::shared_ptr<const void> owner) {
+    auto document = make_document(impl_->memory, parse_threads_for(input) > 1 ? 0 : input.size());
+    document->set_source(input, std::move(owner));
+    build(*document);
+    return document;
+}
+
+MarkdownParser::ParseResult MarkdownParser::parse(std::string_view input, std::shared_ptr<const void> owner,
+                                                  const Limits& limits) {
+    ParseResult result;
+    result.document = make_document(impl_->memory, parse_threads_for(input) > 1 ? 0 : input.size());
+    result.document->set_source(input, std::move(owner));
+    result.status = build(*result.document, &limits);
+    return result;
+}
+
+MarkdownParser::ParseStatus MarkdownParser::build(Document& document, const Limits* limits) const {
+    std::string_view source = document.source();
+    document.set_has_link_definitions(BlockScanner::contains_link_definition(source));
+    
+    // Link reference definitions resolve across chunks, so those documents
+    // are always parsed in one pass
+    ParseStatus status = ParseStatus::Complete;
+    size_t threads = parse_threads_for(source);
+    auto root = threads > 1 && !document.has_link_definitions()
+        ? parse_parallel(document, threads, limits, status)
+        : parse_slice(document, source, 0, limits, &status);
+    root->source_end = source.size();
+    
+    document.set_root(std::move(root));
+    document.regenerate_toc();
+    return status;
+}
+
+// Parses source[begin, end) into the children of a new root node; node
+// offsets are relative to the start of `source`
+Document::NodePtr MarkdownParser::parse_slice(Document& document, std::string_view source, size_t begin,
+                                              const Limits* limits, ParseStatus* status) const {
+    // Create a proper root node - this will be our document container
+    auto root = document.create_node(Document::NodeType::Paragraph);
+    
+    // The root stays at the bottom of the stack for the whole parse
+    Builder builder(document);
+    builder.source = source;
+    builder.limits = limits;
+    builder.node_stack.push(root.get());
+    
+    // md4c reports -1 on internal errors; keep whatever tree was built so far
+    run_md4c(builder, begin);
+    if (status) {
+        *status = builder.status;
+    }
+    return root;
+}
+
+size_t MarkdownParser::parse_threads_for(std::string_view input) const {
+    // Below this, splitting and starting threads costs more than it saves
+    constexpr size_t min_chunk_size = 256 * 1024;
+    if (impl_->parse_threads == 1 || input.size() < 4 * min_chunk_size) {
+        return 1;
+    }
+    
+    size_t threads = impl_->parse_threads;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::min(threads, input.size() / min_chunk_size);
+}
+
+void MarkdownParser::parse_incremental(std::string_view input, ParseCallback callback) {
+    // Nodes only need to live for the duration of the callbacks, so the
+    // input is not retained
+    auto document = make_document(impl_->memory, input.size());
+    auto root = document->create_node(Document::NodeType::Paragraph);
+    
+    Builder builder(*document);
+    builder.source = input;
+    builder.callback = std::move(callback);
+    builder.node_stack.push(root.get());
+    
+    run_md4c(builder, 0);
+    
+    document->set_root(std::move(root));
+}
+
+MarkdownParser::Edit MarkdownParser::Edit::between(std::string_view before, std::string_view after) {
+    size_t limit = std::min(before.size(), after.size());
+    size_t prefix = std::mismatch(before.begin(), before.begin() + limit, after.begin()).first - before.begin();
+    size_t suffix = 0;
+    while (suffix < limit - prefix &&
+           before[before.size() - 1 - suffix] == after[after.size() - 1 - suffix]) {
+        ++suffix;
+    }
+    return {prefix, before.size() - prefix - suffix, after.substr(prefix, after.size() - prefix - suffix)};
+}
+
+namespace {
+
+// Moves untouched nodes' views into `edited` and shifts their offsets
+void rebase(Document::Node* block, std::string_view old_source, std::string_view edited,
+            size_t edit_end, size_t shift, bool after_edit) {
+    std::vector<Document::Node*> pending{block};
+    while (!pending.empty()) {
+        Document::Node* node = pending.back();
+        pending.pop_back();
+        
+        const char* text = node->content.data();
+        if (text >= old_source.data() && text < old_source.data() + old_source.size()) {
+            size_t offset = text - old_source.data();
+            if (offset >= edit_end) {
+                offset += shift;
+            }
+            node->content = edited.substr(offset, node->content.size());
+        }
+        if (after_edit) {
+            node->source_start += shift;
+            node->source_end += shift;
+        }
+        
+        for (auto& child : node->children) {
+            pending.push_back(child.get());
+        }
+    }
+}
+
+// Copies `block` into `document` as rebase() would move it, for a block
+// that another Document still uses. Text outside the old source is viewed
+// where it is.
+Document::NodePtr copy_rebased(Document& document, const Document::Node& block, std::string_view old_source,
+                               std::string_view edited, size_t edit_end, size_t shift) {
+    auto copy_of = [&](const Document::Node& node) {
+        auto copy = document.create_node(node.type);
+        copy->content = node.content;
+        copy->heading_level = node.heading_level;
+        copy->code_language = node.code_language;
+        copy->link_url = node.link_url;
+        copy->image_alt = node.image_alt;
+        copy->list_ordered = node.list_ordered;
+        copy->list_start = node.list_start;
+        copy->source_start = node.source_start;
+        copy->source_end = node.source_end;
+        copy->children.reserve(node.children.size());
+        return copy;
+    };
+    
+    auto root = copy_of(block);
+    std::vector<std::pair<const Document::Node*, Document::Node*>> pending{{&block, root.get()}};
+    while (!pending.empty()) {
+        auto [from, to] = pending.back();
+        pending.pop_back();
+        for (const auto& child : from->children) {
+            to->children.push_back(copy_of(*child));
+            pending.emplace_back(child.get(), to->children.back().get());
+        }
     }
+    rebase(root.get(), old_source, edited, edit_end, shift, true);
+    return root;
+}
+
+} // namespace
+
+// Node creation is not thread-safe, so each chunk is parsed into a Document
+// of its own, which the result then adopts. A chunk boundary only holds if
+// the block before it is closed there; when a fence or HTML block runs
+// across it, the chunks on either side are parsed again as one.
+Document::NodePtr MarkdownParser::parse_parallel(Document& document, size_t threads, const Limits* limits,
+                                                 ParseStatus& status) const {
+    std::string_view source = document.source();
     
-    // Clean up the stack but keep the root
-    while (impl_->node_stack.size() > 1) {
-        impl_->node_stack.pop();
+    struct Chunk {
+        size_t begin;
+        size_t end;
+        std::unique_ptr<Document> part;
+        ParseStatus status = ParseStatus::Complete;
+    };
+    
+    // A few chunks per thread so that one slow chunk doesn't hold up the rest
+    size_t target = std::max<size_t>(1, source.size() / (threads * 4));
+    std::vector<Chunk> chunks;
+    for (size_t begin = 0; begin < source.size();) {
+        size_t end = source.size() - begin <= target
+            ? source.size()
+            : BlockScanner::next_block_boundary(source, begin + target);
+        chunks.push_back({begin, end, nullptr, ParseStatus::Complete});
+        begin = end;
     }
-    // Now pop the root
-    if (!impl_->node_stack.empty()) {
-        impl_->node_stack.pop();
+    
+    auto parse_chunk = [&](Chunk& chunk) {
+        chunk.part = make_document(impl_->memory, chunk.end - chunk.begin);
+        chunk.part->set_root(parse_slice(*chunk.part, source.substr(0, chunk.end), chunk.begin, limits, &chunk.status));
+    };
+    
+    std::atomic<size_t> next_chunk{0};
+    auto work = [&] {
+        for (size_t i = next_chunk++; i < chunks.size(); i = next_chunk++) {
+            parse_chunk(chunks[i]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(threads, chunks.size()); ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
     }
     
-    if (result == 0 || result == -1) {  // md_parse returns 0 on success, we'll be lenient
-        impl_->current_document->set_root(std::move(root));
-        // Only regenerate TOC if we have a valid root
-        if (impl_->current_document->get_root()) {
-            impl_->current_document->regenerate_toc();
+    // A stopped parse keeps the chunks as they are
+    for (const auto& chunk : chunks) {
+        if (chunk.status != ParseStatus::Complete) {
+            status = chunk.status;
+            break;
         }
-    } else {
-        // If parsing failed, still use what we have
-        impl_->current_document->set_root(std::move(root));
     }
     
-    return std::move(impl_->current_document);
+    // Merging twice as many chunks on each retry keeps a block that spans
+    // most of the input from costing more than one more serial parse
+    size_t merge = 1;
+    for (size_t i = 0; status == ParseStatus::Complete && i + 1 < chunks.size();) {
+        const auto& blocks = chunks[i].part->get_root()->children;
+        if (blocks.empty() || BlockScanner::ends_before(source, *blocks.back(), chunks[i].end)) {
+            merge = 1;
+            ++i;
+            continue;
+        }
+        
+        size_t absorbed = std::min(merge, chunks.size() - i - 1);
+        chunks[i].end = chunks[i + absorbed].end;
+        chunks.erase(chunks.begin() + i + 1, chunks.begin() + i + 1 + absorbed);
+        parse_chunk(chunks[i]);
+        status = chunks[i].status;
+        merge *= 2;
+    }
+    
+    auto root = document.create_node(Document::NodeType::Paragraph);
+    size_t block_count = 0;
+    for (const auto& chunk : chunks) {
+        block_count += chunk.part->get_root()->children.size();
+    }
+    root->children.reserve(block_count);
+    for (auto& chunk : chunks) {
+        auto& blocks = chunk.part->get_root()->children;
+        root->children.insert(root->children.end(),
+                              std::make_move_iterator(blocks.begin()), std::make_move_iterator(blocks.end()));
+        document.adopt(std::move(chunk.part));
+    }
+    return root;
 }
 
-void MarkdownParser::parse_incremental(std::string_view input, ParseCallback callback) {
-    impl_->incremental_callback = std::move(callback);
+bool MarkdownParser::reparse(Document& document, const Edit& edit) {
+    std::string_view source = document.source();
+    if (edit.offset > source.size() || edit.removed_len > source.size() - edit.offset) {
+        return false;
+    }
     
-    MD_PARSER parser = {
-        0,
-        impl_->parser_flags,
-        enter_block_callback,
-        leave_block_callback,
-        enter_span_callback,
-        leave_span_callback,
-        text_callback,
-        nullptr,
-        nullptr
+    auto edited = std::make_shared<std::string>();
+    edited->reserve(source.size() - edit.removed_len + edit.inserted_text.size());
+    edited->append(source.substr(0, edit.offset));
+    edited->append(edit.inserted_text);
+    edited->append(source.substr(edit.offset + edit.removed_len));
+    
+    std::string_view text = *edited;
+    return reparse(document, edit, text, std::move(edited));
+}
+
+bool MarkdownParser::reparse(Document& document, const Edit& edit,
+                             std::string_view edited, std::shared_ptr<const void> owner) {
+    std::string_view old_source = document.source();
+    if (edit.offset > old_source.size() || edit.removed_len > old_source.size() - edit.offset ||
+        edited.size() != old_source.size() - edit.removed_len + edit.inserted_text.size()) {
+        return false;
+    }
+    
+    if (!owner) {
+        auto copy = std::make_shared<std::string>(edited);
+        edited = *copy;
+        owner = std::move(copy);
+    }
+    
+    auto parse_everything = [&] {
+        document.clear();
+        document.set_source(edited, std::move(owner));
+        build(document);
+        return true;
     };
     
-    md_parse(input.data(), input.size(), &parser, impl_.get());
+    Splice splice = plan_splice(document, edit, edited, document);
+    if (!splice.parsed) {
+        return parse_everything();
+    }
+    
+    // Swap in the new blocks, then move everything else onto the edited text
+    Document::Node* root = document.get_root();
+    auto& blocks = root->children;
+    if (document.uses_arena()) {
+        size_t replaced = splice.last > splice.first
+            ? blocks[splice.last - 1]->source_end - blocks[splice.first]->source_start
+            : 0;
+        if (document.replaced_bytes() + replaced > edited.size()) {
+            // The new blocks live in the arena that is about to be emptied
+            splice.parsed.reset();
+            return parse_everything();
+        }
+        document.add_replaced_bytes(replaced);
+    }
+    auto& fresh = splice.parsed->children;
+    size_t first = splice.first;
+    size_t fresh_count = fresh.size();
+    size_t edit_end = edit.offset + edit.removed_len;
+    size_t shift = edited.size() - old_source.size();
+    blocks.erase(blocks.begin() + first, blocks.begin() + splice.last);
+    blocks.insert(blocks.begin() + first,
+                  std::make_move_iterator(fresh.begin()), std::make_move_iterator(fresh.end()));
+    
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (i < first || i >= first + fresh_count) {
+            rebase(blocks[i].get(), old_source, edited, edit_end, shift, i >= first);
+        }
+    }
+    root->source_end = edited.size();
+    
+    document.set_source(edited, std::move(owner));
+    document.mark_modified();
+    document.regenerate_toc();
+    return true;
 }
 
-int MarkdownParser::enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
-    auto* impl = static_cast<Impl*>(userdata);
+std::shared_ptr<const Document> MarkdownParser::reparse_version(std::shared_ptr<const Document> base, const Edit& edit,
+                                                                std::string_view edited,
+                                                                std::shared_ptr<const void> owner) {
+    return reparse_version(std::move(base), edit, edited, std::move(owner), Limits{});
+}
+
+std::shared_ptr<const Document> MarkdownParser::reparse_version(std::shared_ptr<const Document> base, const Edit& edit,
+                                                                std::string_view edited,
+                                                                std::shared_ptr<const void> owner,
+                                                                const Limits& limits, ParseStatus* status) {
+    if (status) {
+        *status = ParseStatus::Complete;
+    }
+    std::string_view old_source = base ? base->source() : std::string_view();
+    if (!base || edit.offset > old_source.size() || edit.removed_len > old_source.size() - edit.offset ||
+        edited.size() != old_source.size() - edit.removed_len + edit.inserted_text.size()) {
+        return nullptr;
+    }
     
-    // Safety check for null impl
-    if (!impl) {
-        return 0;
+    if (!owner) {
+        auto copy = std::make_shared<std::string>(edited);
+        edited = *copy;
+        owner = std::move(copy);
     }
     
-    // Handle document root specially
-    if (type == MD_BLOCK_DOC) {
-        // Document root - don't create a new node, it's already created
+    // Only arena nodes can be shared, since no one version owns them. Past a
+    // few versions a full parse lets the older ones go.
+    constexpr size_t max_shared_depth = 8;
+    std::shared_ptr<Document> version = make_document(edit.inserted_text.size());
+    version->set_source(edited, std::move(owner));
+    version->carry_offset_map(*base, edit.offset, edit.removed_len, edit.inserted_text.size());
+    Splice splice;
+    ParseStatus stopped = ParseStatus::Complete;
+    if (base->uses_arena() && version->uses_arena() && base->shared_depth() < max_shared_depth) {
+        splice = plan_splice(*base, edit, edited, *version, &limits, &stopped);
+    }
+    if (!splice.parsed && stopped == ParseStatus::Complete) {
+        stopped = build(*version, &limits);
+        if (stopped == ParseStatus::Complete) {
+            return version;
+        }
+    }
+    if (stopped != ParseStatus::Complete) {
+        if (status) {
+            *status = stopped;
+        }
+        return nullptr;
+    }
+    
+    // Blocks before the edit are shared as they are. Those after it are too
+    // when their offsets stay put, and are otherwise copied with new ones.
+    const auto& blocks = base->get_root()->children;
+    auto& fresh = splice.parsed->children;
+    size_t edit_end = edit.offset + edit.removed_len;
+    size_t shift = edited.size() - old_source.size();
+    auto root = version->create_node(Document::NodeType::Paragraph);
+    root->children.reserve(blocks.size() - (splice.last - splice.first) + fresh.size());
+    for (size_t i = 0; i < splice.first; ++i) {
+        root->children.emplace_back(blocks[i].get());
+    }
+    root->children.insert(root->children.end(),
+                          std::make_move_iterator(fresh.begin()), std::make_move_iterator(fresh.end()));
+    for (size_t i = splice.last; i < blocks.size(); ++i) {
+        if (shift == 0) {
+            root->children.emplace_back(blocks[i].get());
+        } else {
+            root->children.push_back(copy_rebased(*version, *blocks[i], old_source, edited, edit_end, shift));
+        }
+    }
+    root->source_end = edited.size();
+    
+    version->share(std::move(base));
+    version->set_root(std::move(root));
+    version->regenerate_toc();
+    return version;
+}
+
+MarkdownParser::Splice MarkdownParser::plan_splice(const Document& document, const Edit& edit,
+                                                   std::string_view edited, Document& target,
+                                                   const Limits* limits, ParseStatus* status) const {
+    std::string_view old_source = document.source();
+    const Document::Node* root = document.get_root();
+    if (!root || root->children.empty() || document.has_link_definitions()) {
+        return {};
+    }
+    
+    const auto& blocks = root->children;
+    size_t edit_end = edit.offset + edit.removed_len;
+    // Unsigned wraparound makes this a subtraction when text was removed
+    size_t shift = edited.size() - old_source.size();
+    auto line_of = [&](size_t index) {
+        return BlockScanner::line_start(old_source, blocks[index]->source_start);
+    };
+    
+    // Start at the block holding the edit, or the one before it, which a
+    // line typed right after it could continue. Then back up until a blank
+    // line separates the slice from everything before it.
+    size_t first = std::upper_bound(blocks.begin(), blocks.end(), edit.offset,
+        [](size_t offset, const Document::NodePtr& block) { return offset < block->source_start; }) - blocks.begin();
+    first = first == 0 ? 0 : first - 1;
+    while (first > 0) {
+        const Document::Node& previous = *blocks[first - 1];
+        std::string_view gap = old_source.substr(previous.source_end, line_of(first) - previous.source_end);
+        if (std::count(gap.begin(), gap.end(), '\n') >= 2 && !BlockScanner::continues_past_blank_line(old_source, previous)) {
+            break;
+        }
+        --first;
+    }
+    size_t begin = first == 0 ? 0 : line_of(first);
+    
+    // End before the first block that starts on a line after the edit,
+    // moving further out while the new blocks would run into it (an opened
+    // fence, a list that continues)
+    size_t last = std::partition_point(blocks.begin() + first, blocks.end(),
+        [&](const Document::NodePtr& block) {
+            return BlockScanner::line_start(old_source, block->source_start) <= edit_end;
+        }) - blocks.begin();
+    
+    for (size_t step = 1;; step *= 2) {
+        size_t end = (last < blocks.size() ? line_of(last) : old_source.size()) + shift;
+        
+        if (BlockScanner::contains_link_definition(edited.substr(begin, end - begin))) {
+            return {};
+        }
+        
+        bool separated = last == blocks.size() ||
+            (end >= 2 && end - 1 > begin && BlockScanner::is_blank_line(edited, BlockScanner::line_start(edited, end - 1)));
+        if (separated) {
+            ParseStatus slice_status = ParseStatus::Complete;
+            auto parsed = parse_slice(target, edited.substr(0, end), begin, limits, &slice_status);
+            if (slice_status != ParseStatus::Complete) {
+                if (status) {
+                    *status = slice_status;
+                }
+                return {};
+            }
+            if (last == blocks.size() || parsed->children.empty() ||
+                BlockScanner::ends_before(edited, *parsed->children.back(), end)) {
+                return {first, last, std::move(parsed)};
+            }
+        }
+        last = std::min(blocks.size(), last + step);
+    }
+}
+
+int MarkdownParser::enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
+    auto* builder = static_cast<Builder*>(userdata);
+    
+    // Safety check for null builder
+    if (!builder || builder->node_stack.empty()) {
         return 0;
     }
+    if (builder->should_stop()) {
+        return 1;
+    }
     
-    // For all other blocks, we need a parent node
-    if (impl->node_stack.empty()) {
+    builder->flush_text();
+    
+    // Document root - don't create a new node, it's already on the stack
+    if (type == MD_BLOCK_DOC) {
         return 0;
     }
     
-    Document::NodeType node_type;
     switch (type) {
-        case MD_BLOCK_P: node_type = Document::NodeType::Paragraph; break;
+        case MD_BLOCK_P:
+            builder->push(Document::NodeType::Paragraph);
+            break;
         case MD_BLOCK_H: {
-            node_type = Document::NodeType::Heading;
+            auto* node = builder->push(Document::NodeType::Heading);
             auto* h_detail = static_cast<MD_BLOCK_H_DETAIL*>(detail);
-            auto node = std::make_unique<Document::Node>(node_type);
             node->heading_level = h_detail->level;
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            break;
         }
         case MD_BLOCK_CODE: {
-            node_type = Document::NodeType::CodeBlock;
+            auto* node = builder->push(Document::NodeType::CodeBlock);
             auto* code_detail = static_cast<MD_BLOCK_CODE_DETAIL*>(detail);
-            auto node = std::make_unique<Document::Node>(node_type);
             if (code_detail && code_detail->lang.text && code_detail->lang.size > 0) {
-                node->code_language = std::string(code_detail->lang.text, code_detail->lang.size);
+                node->code_language.assign(code_detail->lang.text, code_detail->lang.size);
             }
             if (code_detail && code_detail->info.text && code_detail->info.size > 0) {
                 // info contains the full language specification (e.g., "swift" from ```swift)
-                node->code_language = std::string(code_detail->info.text, code_detail->info.size);
+                node->code_language.assign(code_detail->info.text, code_detail->info.size);
             }
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            break;
         }
-        case MD_BLOCK_QUOTE: node_type = Document::NodeType::BlockQuote; break;
-        case MD_BLOCK_UL: 
+        case MD_BLOCK_QUOTE:
+            builder->push(Document::NodeType::BlockQuote);
+            break;
+        case MD_BLOCK_UL:
+            builder->push(Document::NodeType::List);
+            break;
         case MD_BLOCK_OL: {
-            node_type = Document::NodeType::List;
-            auto node = std::make_unique<Document::Node>(node_type);
-            if (type == MD_BLOCK_OL) {
-                auto* ol_detail = static_cast<MD_BLOCK_OL_DETAIL*>(detail);
-                node->list_ordered = true;
-                node->list_start = ol_detail->start;
-            }
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            auto* node = builder->push(Document::NodeType::List);
+            auto* ol_detail = static_cast<MD_BLOCK_OL_DETAIL*>(detail);
+            node->list_ordered = true;
+            node->list_start = ol_detail->start;
+            break;
         }
-        case MD_BLOCK_LI: node_type = Document::NodeType::ListItem; break;
-        case MD_BLOCK_HR: node_type = Document::NodeType::HorizontalRule; break;
-        case MD_BLOCK_TABLE: node_type = Document::NodeType::Table; break;
+        case MD_BLOCK_LI:
+            builder->push(Document::NodeType::ListItem);
+            break;
+        case MD_BLOCK_HR:
+            builder->push(Document::NodeType::HorizontalRule);
+            break;
+        case MD_BLOCK_HTML:
+            builder->push(Document::NodeType::Html);
+            break;
+        case MD_BLOCK_TABLE:
+            builder->push(Document::NodeType::Table);
+            break;
         case MD_BLOCK_THEAD:
         case MD_BLOCK_TBODY:
-        case MD_BLOCK_TR: node_type = Document::NodeType::TableRow; break;
+        case MD_BLOCK_TR:
+            builder->push(Document::NodeType::TableRow);
+            break;
         case MD_BLOCK_TH:
         case MD_BLOCK_TD: {
-            node_type = Document::NodeType::TableCell;
-            auto node = std::make_unique<Document::Node>(node_type);
+            auto* node = builder->push(Document::NodeType::TableCell);
             // Mark if this is a header cell
             if (type == MD_BLOCK_TH) {
                 node->heading_level = 1;  // Use heading_level as a flag for header cells
             }
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            break;
         }
-        default: return 0;
+        default:
+            builder->push_passthrough();
+            return 0;
     }
     
-    auto node = std::make_unique<Document::Node>(node_type);
-    impl->node_stack.top()->children.push_back(std::move(node));
-    impl->node_stack.push(impl->node_stack.top()->children.back().get());
-    
+    builder->begin_block(type == MD_BLOCK_TH || type == MD_BLOCK_TD);
     return 0;
 }
 
 int MarkdownParser::leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata) {
-    auto* impl = static_cast<Impl*>(userdata);
-    
-    if (!impl) {
-        return 0;
-    }
+    auto* builder = static_cast<Builder*>(userdata);
     
     // Don't pop for document root since we didn't push for it
-    if (type == MD_BLOCK_DOC) {
+    if (!builder || type == MD_BLOCK_DOC) {
         return 0;
     }
     
-    if (!impl->node_stack.empty()) {
-        impl->node_stack.pop();
-    }
-    
+    builder->flush_text();
+    builder->end_block(type, detail);
+    builder->pop();
     return 0;
 }
 
 int MarkdownParser::enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
-    auto* impl = static_cast<Impl*>(userdata);
+    auto* builder = static_cast<Builder*>(userdata);
     
-    // Safety check for null impl or empty stack
-    if (!impl || impl->node_stack.empty()) {
+    // Safety check for null builder or empty stack
+    if (!builder || builder->node_stack.empty()) {
         return 0;
     }
+    if (builder->should_stop()) {
+        return 1;
+    }
+    
+    builder->flush_text();
     
-    Document::NodeType node_type;
     switch (type) {
-        case MD_SPAN_EM: node_type = Document::NodeType::Emphasis; break;
-        case MD_SPAN_STRONG: node_type = Document::NodeType::Strong; break;
-        case MD_SPAN_CODE: node_type = Document::NodeType::Code; break;
-        case MD_SPAN_DEL: node_type = Document::NodeType::Strikethrough; break;
+        case MD_SPAN_EM:
+            builder->push(Document::NodeType::Emphasis);
+            break;
+        case MD_SPAN_STRONG:
+            builder->push(Document::NodeType::Strong);
+            break;
+        case MD_SPAN_CODE:
+            builder->push(Document::NodeType::Code);
+            break;
+        case MD_SPAN_DEL:
+            builder->push(Document::NodeType::Strikethrough);
+            break;
         case MD_SPAN_A: {
-            node_type = Document::NodeType::Link;
+            auto* node = builder->push(Document::NodeType::Link);
             auto* link_detail = static_cast<MD_SPAN_A_DETAIL*>(detail);
-            if (!link_detail || !link_detail->href.text) {
-                return 0;
+            if (link_detail && link_detail->href.text) {
+                node->link_url.assign(link_detail->href.text, link_detail->href.size);
             }
-            auto node = std::make_unique<Document::Node>(node_type);
-            node->link_url = std::string(link_detail->href.text, link_detail->href.size);
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            break;
         }
         case MD_SPAN_IMG: {
-            node_type = Document::NodeType::Image;
+            auto* node = builder->push(Document::NodeType::Image);
             auto* img_detail = static_cast<MD_SPAN_IMG_DETAIL*>(detail);
-            if (!img_detail || !img_detail->src.text) {
-                return 0;
+            if (img_detail && img_detail->src.text) {
+                node->link_url.assign(img_detail->src.text, img_detail->src.size);
             }
-            auto node = std::make_unique<Document::Node>(node_type);
-            node->link_url = std::string(img_detail->src.text, img_detail->src.size);
-            impl->node_stack.top()->children.push_back(std::move(node));
-            impl->node_stack.push(impl->node_stack.top()->children.back().get());
-            return 0;
+            break;
         }
-        default: return 0;
+        default:
+            builder->push_passthrough();
+            break;
     }
     
-    auto node = std::make_unique<Document::Node>(node_type);
-    impl->node_stack.top()->children.push_back(std::move(node));
-    impl->node_stack.push(impl->node_stack.top()->children.back().get());
-    
     return 0;
 }
 
 int MarkdownParser::leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata) {
-    auto* impl = static_cast<Impl*>(userdata);
+    auto* builder = static_cast<Builder*>(userdata);
     
-    // Safety check for null impl
-    if (!impl) {
+    // Safety check for null builder
+    if (!builder) {
         return 0;
     }
     
-    if (!impl->node_stack.empty()) {
-        impl->node_stack.pop();
-    }
-    
+    builder->flush_text();
+    builder->end_span(type);
+    builder->pop();
     return 0;
 }
 
 int MarkdownParser::text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
-    auto* impl = static_cast<Impl*>(userdata);
+    auto* builder = static_cast<Builder*>(userdata);
     
     // Safety checks
-    if (!impl || impl->node_stack.empty() || !text || size == 0) {
+    if (!builder || builder->node_stack.empty() || !text || size == 0) {
         return 0;
     }
+    if (builder->should_stop()) {
+        return 1;
+    }
     
-    auto node = std::make_unique<Document::Node>(Document::NodeType::Text);
-    node->content = std::string(text, size);
-    impl->node_stack.top()->children.push_back(std::move(node));
-    
-    if (impl->incremental_callback) {
-        impl->incremental_callback(*node);
+    switch (type) {
+        case MD_TEXT_BR:
+        case MD_TEXT_SOFTBR:
+            builder->note_line_break();
+            builder->append_text(std::string_view(text, size), std::string_view(text, size));
+            break;
+        case MD_TEXT_NULLCHAR:
+            // U+FFFD REPLACEMENT CHARACTER, as CommonMark requires
+            builder->append_text("\xEF\xBF\xBD", std::string_view(text, size));
+            break;
+        case MD_TEXT_ENTITY:
+            builder->entity_text.clear();
+            StringUtils::unescape_html(std::string_view(text, size), builder->entity_text);
+            builder->append_text(builder->entity_text, std::string_view(text, size));
+            break;
+        default:
+            builder->append_text(std::string_view(text, size), std::string_view(text, size));
+            break;
     }
     
     return 0;
 }
 
 void MarkdownParser::detect_wikilinks(std::string_view text, std::vector<Document::Link>& links) {
-    detect_wikilinks_simd(text.data(), text.size(), links);
-}
-
-void MarkdownParser::detect_wikilinks_simd(const char* text, size_t len, std::vector<Document::Link>& links) {
-    size_t i = 0;
-    
-    #ifdef __AVX2__
-    const __m256i open_bracket = _mm256_set1_epi8('[');
-    const __m256i close_bracket = _mm256_set1_epi8(']');
-    while (i + 32 <= len) {
-        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
-        __m256i open_match = _mm256_cmpeq_epi8(chunk, open_bracket);
-        __m256i close_match = _mm256_cmpeq_epi8(chunk, close_bracket);
-        
-        uint32_t open_mask = _mm256_movemask_epi8(open_match);
-        uint32_t close_mask = _mm256_movemask_epi8(close_match);
-        
-        while (open_mask) {
-            int open_pos = __builtin_ctz(open_mask);
-            size_t abs_open = i + open_pos;
-            
-            if (abs_open + 1 < len && text[abs_open + 1] == '[') {
-                size_t link_start = abs_open + 2;
-                size_t link_end = link_start;
-                
-                while (link_end + 1 < len && 
-                       !(text[link_end] == ']' && text[link_end + 1] == ']')) {
-                    link_end++;
-                }
-                
-                if (link_end + 1 < len) {
-                    Document::Link link;
-                    link.text = std::string(text + link_start, link_end - link_start);
-                    link.url = link.text;
-                    link.position = abs_open;
-                    link.is_wikilink = true;
-                    links.push_back(link);
-                }
-            }
-            
-            open_mask &= open_mask - 1;
-        }
-        
-        i += 32;
-    }
-    #endif
-    
-    // Handle remaining bytes
-    for (; i < len - 1; ++i) {
-        if (text[i] == '[' && text[i + 1] == '[') {
-            size_t link_start = i + 2;
-            size_t link_end = link_start;
-            
-            while (link_end + 1 < len && 
-                   !(text[link_end] == ']' && text[link_end + 1] == ']')) {
-                link_end++;
-            }
-            
-            if (link_end + 1 < len) {
-                Document::Link link;
-                link.text = std::string(text + link_start, link_end - link_start);
-                link.url = link.text;
-                link.position = i;
-                link.is_wikilink = true;
-                links.push_back(link);
-                
-                i = link_end + 1;
-            }
-        }
-    }
+    StructuralScanner::scan(text, links);
 }
 
 void MarkdownParser::enable_github_extensions(bool enable) {
@@ -390,4 +1141,16 @@ void MarkdownParser::enable_strikethrough(bool enable) {
     }
 }
 
+void MarkdownParser::enable_arena_allocation(bool enable) {
+    impl_->use_arena = enable;
+}
+
+void MarkdownParser::set_parse_threads(size_t threads) {
+    impl_->parse_threads = threads;
+}
+
+uint32_t MarkdownParser::options_key() const {
+    return impl_->parser_flags;
+}
+
 } // namespace mdviewer
\ No newline at end of file
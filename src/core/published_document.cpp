@@ -0,0 +1,59 @@
+#include "core/published_document.h"
+
+namespace mdviewer {
+
+PublishedDocument::PublishedDocument(Snapshot initial) : current_(std::move(initial)) {}
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+
+PublishedDocument::Snapshot PublishedDocument::snapshot() const {
+    return current_.load(std::memory_order_acquire);
+}
+
+PublishedDocument::Snapshot PublishedDocument::publish(Snapshot next) {
+    Snapshot previous = current_.exchange(std::move(next), std::memory_order_acq_rel);
+    generation_.fetch_add(1, std::memory_order_release);
+    return previous;
+}
+
+bool PublishedDocument::publish_if_current(const Snapshot& expected, Snapshot next) {
+    Snapshot current = expected;
+    if (!current_.compare_exchange_strong(current, std::move(next), std::memory_order_acq_rel)) {
+        return false;
+    }
+    generation_.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+#else
+
+// libc++ has no std::atomic<std::shared_ptr> yet; the free functions it
+// replaces do the same job
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+
+PublishedDocument::Snapshot PublishedDocument::snapshot() const {
+    return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+}
+
+PublishedDocument::Snapshot PublishedDocument::publish(Snapshot next) {
+    Snapshot previous = std::atomic_exchange_explicit(&current_, std::move(next), std::memory_order_acq_rel);
+    generation_.fetch_add(1, std::memory_order_release);
+    return previous;
+}
+
+bool PublishedDocument::publish_if_current(const Snapshot& expected, Snapshot next) {
+    Snapshot current = expected;
+    if (!std::atomic_compare_exchange_strong_explicit(&current_, &current, std::move(next),
+                                                      std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return false;
+    }
+    generation_.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+#pragma clang diagnostic pop
+
+#endif
+
+} // namespace mdviewer
@@ -0,0 +1,215 @@
+#pragma once
+
+// 64-byte views over text for the vector kernels in mdviewer_core. A
+// kernel is written once as a template over these block types, then
+// instantiated inside one wrapper function per instruction set:
+//
+//   MDVIEWER_KERNEL_AVX2 size_t count_avx2(std::string_view text) {
+//       return count<simd::Avx2Block>(text);
+//   }
+//
+// The wrapper's target attribute lets it hold AVX2 code in a binary built
+// for the baseline CPU, and flatten inlines the template and the block's
+// members into it. SimdDispatch decides which wrapper runs.
+
+#include <cstdint>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define MDVIEWER_SIMD_X86 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define MDVIEWER_SIMD_NEON 1
+#endif
+
+#define MDVIEWER_KERNEL_SCALAR __attribute__((flatten))
+#if defined(MDVIEWER_SIMD_X86)
+#define MDVIEWER_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define MDVIEWER_TARGET_AVX2 __attribute__((target("avx2,bmi,popcnt")))
+#define MDVIEWER_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,bmi,popcnt")))
+#define MDVIEWER_KERNEL_SSE42 __attribute__((target("sse4.2,popcnt"), flatten))
+#define MDVIEWER_KERNEL_AVX2 __attribute__((target("avx2,bmi,popcnt"), flatten))
+#define MDVIEWER_KERNEL_AVX512 __attribute__((target("avx512f,avx512bw,bmi,popcnt"), flatten))
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+#define MDVIEWER_KERNEL_NEON __attribute__((flatten))
+#endif
+
+namespace mdviewer::simd {
+
+// Each block type loads 64 bytes and answers questions about them: which
+// bytes equal `c`, which are at most `c` (unsigned), and whether any byte
+// is one of a few characters at all. Bit i of a mask stands for byte i.
+// Vector types combine with the built-in operators (|) that GCC and Clang
+// define for them.
+
+struct ScalarBlock {
+    const uint8_t* bytes;
+    
+    explicit ScalarBlock(const char* data) : bytes(reinterpret_cast<const uint8_t*>(data)) {}
+    
+    uint64_t eq(char c) const {
+        uint64_t mask = 0;
+        for (int i = 0; i < 64; ++i) {
+            mask |= uint64_t{bytes[i] == static_cast<uint8_t>(c)} << i;
+        }
+        return mask;
+    }
+    
+    uint64_t at_most(char c) const {
+        uint64_t mask = 0;
+        for (int i = 0; i < 64; ++i) {
+            mask |= uint64_t{bytes[i] <= static_cast<uint8_t>(c)} << i;
+        }
+        return mask;
+    }
+    
+    template <typename... Chars>
+    bool any_of(Chars... cs) const {
+        for (int i = 0; i < 64; ++i) {
+            if (((bytes[i] == static_cast<uint8_t>(cs)) || ...)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+#if defined(MDVIEWER_SIMD_X86)
+struct Sse42Block {
+    // Four named registers rather than an array, which compilers tend to
+    // keep on the stack
+    __m128i chunk0, chunk1, chunk2, chunk3;
+    
+    MDVIEWER_TARGET_SSE42 explicit Sse42Block(const char* data)
+        : chunk0(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+          chunk1(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16))),
+          chunk2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32))),
+          chunk3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48))) {}
+    
+    template <typename Compare>
+    MDVIEWER_TARGET_SSE42 uint64_t mask(Compare compare) const {
+        return uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(compare(chunk0)))} |
+               uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(compare(chunk1)))} << 16 |
+               uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(compare(chunk2)))} << 32 |
+               uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(compare(chunk3)))} << 48;
+    }
+    
+    MDVIEWER_TARGET_SSE42 uint64_t eq(char c) const {
+        const __m128i needle = _mm_set1_epi8(c);
+        return mask([needle](__m128i chunk) MDVIEWER_TARGET_SSE42 { return _mm_cmpeq_epi8(chunk, needle); });
+    }
+    
+    MDVIEWER_TARGET_SSE42 uint64_t at_most(char c) const {
+        const __m128i limit = _mm_set1_epi8(c);
+        return mask([limit](__m128i chunk) MDVIEWER_TARGET_SSE42 {
+            return _mm_cmpeq_epi8(_mm_min_epu8(chunk, limit), chunk);
+        });
+    }
+    
+    template <typename... Chars>
+    MDVIEWER_TARGET_SSE42 bool any_of(Chars... cs) const {
+        auto matches = [cs...](__m128i chunk) MDVIEWER_TARGET_SSE42 {
+            return (_mm_cmpeq_epi8(chunk, _mm_set1_epi8(cs)) | ...);
+        };
+        const __m128i found = matches(chunk0) | matches(chunk1) | matches(chunk2) | matches(chunk3);
+        return !_mm_testz_si128(found, found);
+    }
+};
+
+struct Avx2Block {
+    __m256i low;
+    __m256i high;
+    
+    MDVIEWER_TARGET_AVX2 explicit Avx2Block(const char* data)
+        : low(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data))),
+          high(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32))) {}
+    
+    MDVIEWER_TARGET_AVX2 static uint64_t movemask(__m256i low_matches, __m256i high_matches) {
+        return uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(low_matches))} |
+               uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(high_matches))} << 32;
+    }
+    
+    MDVIEWER_TARGET_AVX2 uint64_t eq(char c) const {
+        const __m256i needle = _mm256_set1_epi8(c);
+        return movemask(_mm256_cmpeq_epi8(low, needle), _mm256_cmpeq_epi8(high, needle));
+    }
+    
+    MDVIEWER_TARGET_AVX2 uint64_t at_most(char c) const {
+        const __m256i limit = _mm256_set1_epi8(c);
+        return movemask(_mm256_cmpeq_epi8(_mm256_min_epu8(low, limit), low),
+                        _mm256_cmpeq_epi8(_mm256_min_epu8(high, limit), high));
+    }
+    
+    template <typename... Chars>
+    MDVIEWER_TARGET_AVX2 bool any_of(Chars... cs) const {
+        auto matches = [cs...](__m256i half) MDVIEWER_TARGET_AVX2 {
+            return (_mm256_cmpeq_epi8(half, _mm256_set1_epi8(cs)) | ...);
+        };
+        const __m256i found = matches(low) | matches(high);
+        return !_mm256_testz_si256(found, found);
+    }
+};
+
+struct Avx512Block {
+    __m512i bytes;
+    
+    MDVIEWER_TARGET_AVX512 explicit Avx512Block(const char* data) : bytes(_mm512_loadu_si512(data)) {}
+    
+    MDVIEWER_TARGET_AVX512 uint64_t eq(char c) const {
+        return _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(c));
+    }
+    
+    MDVIEWER_TARGET_AVX512 uint64_t at_most(char c) const {
+        return _mm512_cmple_epu8_mask(bytes, _mm512_set1_epi8(c));
+    }
+    
+    template <typename... Chars>
+    MDVIEWER_TARGET_AVX512 bool any_of(Chars... cs) const {
+        return (_mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(cs)) | ...) != 0;
+    }
+};
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+struct NeonBlock {
+    uint8x16_t chunk0, chunk1, chunk2, chunk3;
+    
+    explicit NeonBlock(const char* data)
+        : chunk0(vld1q_u8(reinterpret_cast<const uint8_t*>(data))),
+          chunk1(vld1q_u8(reinterpret_cast<const uint8_t*>(data) + 16)),
+          chunk2(vld1q_u8(reinterpret_cast<const uint8_t*>(data) + 32)),
+          chunk3(vld1q_u8(reinterpret_cast<const uint8_t*>(data) + 48)) {}
+    
+    // NEON has no movemask: keep one distinct bit per lane, then pairwise
+    // add neighbouring lanes until each byte holds eight lanes' bits
+    template <typename Compare>
+    uint64_t mask(Compare compare) const {
+        const uint8x16_t lane_bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        uint8x16_t sum01 = vpaddq_u8(vandq_u8(compare(chunk0), lane_bits), vandq_u8(compare(chunk1), lane_bits));
+        uint8x16_t sum23 = vpaddq_u8(vandq_u8(compare(chunk2), lane_bits), vandq_u8(compare(chunk3), lane_bits));
+        uint8x16_t sum = vpaddq_u8(sum01, sum23);
+        sum = vpaddq_u8(sum, sum);
+        return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+    }
+    
+    uint64_t eq(char c) const {
+        const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+        return mask([needle](uint8x16_t chunk) { return vceqq_u8(chunk, needle); });
+    }
+    
+    uint64_t at_most(char c) const {
+        const uint8x16_t limit = vdupq_n_u8(static_cast<uint8_t>(c));
+        return mask([limit](uint8x16_t chunk) { return vcleq_u8(chunk, limit); });
+    }
+    
+    template <typename... Chars>
+    bool any_of(Chars... cs) const {
+        auto matches = [cs...](uint8x16_t chunk) {
+            return (vceqq_u8(chunk, vdupq_n_u8(static_cast<uint8_t>(cs))) | ...);
+        };
+        return vmaxvq_u8(matches(chunk0) | matches(chunk1) | matches(chunk2) | matches(chunk3)) != 0;
+    }
+};
+#endif
+
+} // namespace mdviewer::simd
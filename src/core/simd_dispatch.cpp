@@ -0,0 +1,130 @@
+#include "core/simd_dispatch.h"
+#include <cstdlib>
+#if defined(__APPLE__) && defined(__x86_64__)
+#include <sys/sysctl.h>
+#endif
+
+namespace mdviewer {
+
+namespace {
+
+constexpr SimdLevel kAllLevels[] = {
+    SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON,
+};
+
+#if defined(__APPLE__) && defined(__x86_64__)
+// macOS turns on AVX-512 register state the first time a thread uses it,
+// so XCR0, which the compiler's feature check reads, doesn't report it
+// beforehand. The kernel's own flags do.
+bool sysctl_flag(const char* name) {
+    int value = 0;
+    size_t size = sizeof(value);
+    return sysctlbyname(name, &value, &size, nullptr, 0) == 0 && value != 0;
+}
+#endif
+
+bool cpu_supports(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return true;
+#if defined(__x86_64__)
+        case SimdLevel::SSE42:
+            return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+        case SimdLevel::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi");
+        case SimdLevel::AVX512:
+#if defined(__APPLE__)
+            return sysctl_flag("hw.optional.avx512f") && sysctl_flag("hw.optional.avx512bw") &&
+                   __builtin_cpu_supports("bmi");
+#else
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                   __builtin_cpu_supports("bmi");
+#endif
+#elif defined(__aarch64__)
+        case SimdLevel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+// One bit per level, probed once
+unsigned supported_mask() {
+    static const unsigned mask = [] {
+        unsigned bits = 0;
+        for (SimdLevel level : kAllLevels) {
+            if (cpu_supports(level)) {
+                bits |= 1u << static_cast<unsigned>(level);
+            }
+        }
+        return bits;
+    }();
+    return mask;
+}
+
+} // namespace
+
+SimdLevel SimdDispatch::detected() {
+    SimdLevel best = SimdLevel::Scalar;
+    for (SimdLevel level : kAllLevels) {
+        if (supported(level)) {
+            best = level;
+        }
+    }
+    return best;
+}
+
+SimdLevel SimdDispatch::active() {
+    static const SimdLevel level = [] {
+        if (const char* requested = std::getenv("INKWELL_SIMD")) {
+            auto parsed = parse(requested);
+            if (parsed && supported(*parsed)) {
+                return *parsed;
+            }
+        }
+        return detected();
+    }();
+    return level;
+}
+
+bool SimdDispatch::supported(SimdLevel level) {
+    return supported_mask() & (1u << static_cast<unsigned>(level));
+}
+
+std::vector<SimdLevel> SimdDispatch::supported_levels() {
+    std::vector<SimdLevel> levels;
+    for (SimdLevel level : kAllLevels) {
+        if (supported(level)) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
+const char* SimdDispatch::name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::SSE42:
+            return "sse4.2";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::AVX512:
+            return "avx512";
+        case SimdLevel::NEON:
+            return "neon";
+    }
+    return "scalar";
+}
+
+std::optional<SimdLevel> SimdDispatch::parse(std::string_view name) {
+    for (SimdLevel level : kAllLevels) {
+        if (name == SimdDispatch::name(level)) {
+            return level;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace mdviewer
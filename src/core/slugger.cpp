@@ -0,0 +1,140 @@
+#include "core/slugger.h"
+#include <array>
+#include <cstdint>
+
+namespace mdviewer {
+
+namespace {
+
+constexpr bool in(uint32_t cp, uint32_t first, uint32_t last) {
+    return cp >= first && cp <= last;
+}
+
+// Decodes the sequence at `pos` and moves past it; malformed sequences
+// decode to U+FFFD
+uint32_t next_codepoint(std::string_view text, size_t& pos) {
+    const unsigned char lead = text[pos++];
+    if (lead < 0x80) {
+        return lead;
+    }
+    size_t needed = lead >= 0xF0 && lead < 0xF8 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC2 && lead < 0xE0 ? 1 : 0;
+    uint32_t cp = lead & (0x3F >> needed);
+    size_t end = pos + needed;
+    if (needed == 0 || end > text.size()) {
+        return 0xFFFD;
+    }
+    for (; pos < end; ++pos) {
+        const unsigned char byte = text[pos];
+        if ((byte & 0xC0) != 0x80) {
+            return 0xFFFD;
+        }
+        cp = cp << 6 | (byte & 0x3F);
+    }
+    return cp;
+}
+
+void append_utf8(uint32_t cp, std::string& out) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | cp >> 6);
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | cp >> 12);
+        out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | cp >> 18);
+        out += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+        out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Punctuation, symbols, spacing other than U+0020, format characters
+// and emoji, which GitHub drops. Letters, marks and numbers stay.
+constexpr bool is_dropped(uint32_t cp) {
+    if (cp < 0x80) {
+        return !(in(cp, 'a', 'z') || in(cp, 'A', 'Z') || in(cp, '0', '9') || cp == '-' || cp == '_' || cp == ' ');
+    }
+    if (in(cp, 0x80, 0xBF)) {
+        // Latin-1 punctuation and symbols, bar ordinal indicators, micro
+        // sign, superscripts and fractions
+        return !(cp == 0xAA || cp == 0xB2 || cp == 0xB3 || cp == 0xB5 || cp == 0xB9 || cp == 0xBA ||
+                 in(cp, 0xBC, 0xBE));
+    }
+    return cp == 0xD7 || cp == 0xF7 || in(cp, 0x2000, 0x206F) || in(cp, 0x20A0, 0x20CF) ||
+           in(cp, 0x2100, 0x214F) || in(cp, 0x2190, 0x2BFF) || in(cp, 0x2E00, 0x2E7F) ||
+           in(cp, 0x3000, 0x3004) || in(cp, 0x3008, 0x3020) || in(cp, 0xFE00, 0xFE6F) ||
+           in(cp, 0xFF01, 0xFF0F) || in(cp, 0xFF1A, 0xFF20) || in(cp, 0xFF3B, 0xFF40) ||
+           in(cp, 0xFF5B, 0xFF65) || cp == 0xFEFF || cp == 0xFFFD || in(cp, 0x1F000, 0x1FAFF) ||
+           in(cp, 0xE0000, 0xE007F);
+}
+
+constexpr uint32_t to_lower(uint32_t cp) {
+    if (in(cp, 'A', 'Z') || (in(cp, 0xC0, 0xDE) && cp != 0xD7) || (in(cp, 0x391, 0x3AB) && cp != 0x3A2) ||
+        in(cp, 0x410, 0x42F)) {
+        return cp + 0x20;
+    }
+    if (in(cp, 0x400, 0x40F)) {
+        return cp + 0x50;
+    }
+    if (cp == 0x178) {
+        return 0xFF;
+    }
+    // Latin Extended-A pairs each capital with the small letter after it,
+    // at even codepoints and, from U+0139 to U+0148 and U+0179 on, odd ones
+    const bool odd_capitals = in(cp, 0x139, 0x148) || in(cp, 0x179, 0x17E);
+    if ((in(cp, 0x100, 0x137) || in(cp, 0x14A, 0x177) || odd_capitals) && (cp % 2 == 1) == odd_capitals &&
+        cp != 0x130) {
+        return cp + 1;
+    }
+    return cp;
+}
+
+} // namespace
+
+std::string Slugger::slugify(std::string_view text) {
+    // What each ASCII character becomes, 0 when it's dropped
+    static constexpr auto ascii = [] {
+        std::array<char, 128> table{};
+        for (uint32_t c = 0; c < 128; ++c) {
+            table[c] = c == ' ' ? '-' : is_dropped(c) ? 0 : static_cast<char>(to_lower(c));
+        }
+        return table;
+    }();
+    
+    std::string slug;
+    slug.reserve(text.size());
+    for (size_t pos = 0; pos < text.size();) {
+        const unsigned char c = text[pos];
+        if (c < 0x80) {
+            if (ascii[c]) {
+                slug += ascii[c];
+            }
+            ++pos;
+            continue;
+        }
+        const uint32_t cp = next_codepoint(text, pos);
+        if (!is_dropped(cp)) {
+            append_utf8(to_lower(cp), slug);
+        }
+    }
+    return slug;
+}
+
+std::string Slugger::slug(std::string_view text) {
+    std::string base = slugify(text);
+    if (occurrences_.emplace(base, 0).second) {
+        return base;
+    }
+    // Count on from the base, as GitHub does, until the slug is free
+    size_t& count = occurrences_[base];
+    std::string slug;
+    do {
+        slug = base + '-' + std::to_string(++count);
+    } while (!occurrences_.emplace(slug, 0).second);
+    return slug;
+}
+
+} // namespace mdviewer
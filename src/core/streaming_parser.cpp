@@ -0,0 +1,98 @@
+#include "core/streaming_parser.h"
+#include "core/markdown_parser.h"
+#include "core/block_scanner.h"
+#include <vector>
+
+namespace mdviewer {
+
+namespace {
+
+void shift_offsets(Document::Node& block, size_t delta) {
+    std::vector<Document::Node*> pending{&block};
+    while (!pending.empty()) {
+        Document::Node* node = pending.back();
+        pending.pop_back();
+        node->source_start += delta;
+        node->source_end += delta;
+        for (auto& child : node->children) {
+            pending.push_back(child.get());
+        }
+    }
+}
+
+} // namespace
+
+StreamingParser::StreamingParser(const MarkdownParser& parser, BlockCallback callback)
+    : parser_(parser), callback_(std::move(callback)) {}
+
+void StreamingParser::feed(std::string_view bytes) {
+    buffer_.append(bytes);
+    
+    // Only complete lines can be boundaries: whether a line is indented or
+    // opens a list item decides if the block above it continues. Without a
+    // newline in `bytes` there are none to look at, so a long line that
+    // arrives in pieces is read once rather than on every feed.
+    size_t newline = bytes.rfind('\n');
+    if (newline == std::string_view::npos) {
+        return;
+    }
+    size_t last_newline = buffer_.size() - bytes.size() + newline;
+    for (size_t line = BlockScanner::next_block_boundary(buffer_, scan_from_); line < last_newline;
+         line = BlockScanner::next_block_boundary(buffer_, line + 1)) {
+        boundary_ = line;
+    }
+    scan_from_ = last_newline + 1;
+    
+    if (boundary_ > 0 && buffer_.size() >= retry_size_) {
+        flush(boundary_, false);
+    }
+}
+
+void StreamingParser::finish() {
+    if (!buffer_.empty()) {
+        flush(buffer_.size(), true);
+    }
+    buffer_.clear();
+    consumed_ = scan_from_ = boundary_ = retry_size_ = 0;
+}
+
+void StreamingParser::flush(size_t end, bool final) {
+    std::string_view text = buffer_;
+    
+    // Declared first so the tree goes before the arena it lives in
+    auto document = parser_.make_document(end);
+    auto root = parser_.parse_slice(*document, text.substr(0, end), 0);
+    auto& blocks = root->children;
+    
+    // A fence or HTML block can run on past `end`. The blocks before it are
+    // still done if it starts on a line of its own after a blank line.
+    size_t closed = blocks.size();
+    size_t keep_from = end;
+    if (!final && !blocks.empty() && !BlockScanner::ends_before(text, *blocks.back(), end)) {
+        size_t line = BlockScanner::line_start(text, blocks.back()->source_start);
+        bool separated = closed > 1 && line > 0 &&
+            BlockScanner::is_blank_line(text, BlockScanner::line_start(text, line - 1)) &&
+            BlockScanner::ends_before(text, *blocks[closed - 2], line);
+        closed = separated ? closed - 1 : 0;
+        keep_from = separated ? line : 0;
+    }
+    
+    for (size_t i = 0; i < closed; ++i) {
+        shift_offsets(*blocks[i], consumed_);
+        if (callback_) {
+            callback_(*blocks[i]);
+        }
+    }
+    
+    root.reset();
+    buffer_.erase(0, keep_from);
+    consumed_ += keep_from;
+    scan_from_ -= std::min(scan_from_, keep_from);
+    boundary_ -= std::min(boundary_, keep_from);
+    
+    // Reparsing an open block on every feed would be quadratic in its
+    // size, so wait until it has doubled
+    retry_size_ = keep_from == end ? 0 : 2 * buffer_.size();
+}
+
+} // namespace mdviewer
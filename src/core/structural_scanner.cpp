@@ -0,0 +1,437 @@
+#include "core/structural_scanner.h"
+#include "core/block_scanner.h"
+#include "simd_block.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace mdviewer {
+
+namespace {
+
+constexpr size_t npos = std::string_view::npos;
+
+// Per-byte classes of one 64-byte block, bit i standing for byte i
+struct ByteMasks {
+    uint64_t open_bracket;
+    uint64_t close_bracket;
+    uint64_t pipe;
+    uint64_t hash;
+    uint64_t backtick;
+    uint64_t tilde;
+    uint64_t whitespace;  // bytes up to ' ', control characters included
+};
+
+template <typename Block>
+ByteMasks classify(const Block& block) {
+    return ByteMasks{
+        block.eq('['),
+        block.eq(']'),
+        block.eq('|'),
+        block.eq('#'),
+        block.eq('`'),
+        block.eq('~'),
+        block.at_most(' '),
+    };
+}
+
+bool is_tag_char(unsigned char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '-' || c == '/' || c >= 0x80;
+}
+
+size_t run_length(std::string_view text, size_t pos) {
+    size_t end = pos;
+    while (end < text.size() && text[end] == text[pos]) {
+        ++end;
+    }
+    return end - pos;
+}
+
+// Visits the structural positions of one text in order and builds links
+// and tags from them
+class Extractor {
+public:
+    Extractor(std::string_view text, std::vector<Document::Link>& links, std::vector<StructuralScanner::Tag>* tags)
+        : text_(text), links_(links), tags_(tags) {}
+    
+    // Makes room for `count` more links at once, rather than growing the
+    // vector one link at a time
+    void expect_links(size_t count) {
+        if (links_.size() + count > links_.capacity()) {
+            links_.reserve(std::max(links_.size() + count, 2 * links_.capacity()));
+        }
+    }
+    
+    // `pos` is the second '[' of a "[["
+    void open_link(size_t pos) {
+        open_ = pos;
+        alias_ = npos;
+    }
+    
+    void pipe(size_t pos) {
+        if (open_ != npos && alias_ == npos) {
+            alias_ = pos;
+        }
+    }
+    
+    // `pos` is the second ']' of a "]]"
+    void close_link(size_t pos) {
+        size_t open = open_;
+        size_t alias = alias_;
+        open_ = npos;
+        
+        size_t target_start = open + 1;
+        size_t text_end = pos - 1;
+        if (open == npos || text_end <= target_start ||
+            std::memchr(text_.data() + target_start, '\n', text_end - target_start)) {
+            return;
+        }
+        
+        size_t target_end = alias == npos ? text_end : alias;
+        size_t first_bracket = open - 1;
+        bool embed = first_bracket > 0 && text_[first_bracket - 1] == '!';
+        
+        Document::Link link;
+        link.url = std::string(text_.substr(target_start, target_end - target_start));
+        link.text = alias == npos || alias + 1 == text_end
+            ? link.url : std::string(text_.substr(alias + 1, text_end - alias - 1));
+        link.position = embed ? first_bracket - 1 : first_bracket;
+        link.is_wikilink = true;
+        link.is_embed = embed;
+        links_.push_back(std::move(link));
+    }
+    
+    // `pos` is a '#' at the start of the text or after whitespace
+    void tag(size_t pos) {
+        if (!tags_) {
+            return;
+        }
+        size_t end = pos + 1;
+        bool has_non_digit = false;
+        while (end < text_.size() && is_tag_char(static_cast<unsigned char>(text_[end]))) {
+            has_non_digit |= text_[end] < '0' || text_[end] > '9';
+            ++end;
+        }
+        if (has_non_digit) {
+            tags_->push_back({text_.substr(pos + 1, end - pos - 1), pos});
+        }
+    }
+    
+    // `pos` starts a run of backticks or tildes: a fence opener when it
+    // begins a line, otherwise (backticks only) a code span opener.
+    // Returns where scanning resumes, past any code that was skipped.
+    size_t code(size_t pos) {
+        char marker = text_[pos];
+        size_t length = run_length(text_, pos);
+        if (length >= 3 && starts_line(pos)) {
+            size_t info_end = BlockScanner::line_end(text_, pos);
+            bool backtick_in_info = marker == '`' &&
+                text_.substr(pos + length, info_end - pos - length).find('`') != npos;
+            if (!backtick_in_info) {
+                return skip_fence(info_end, marker, length);
+            }
+        }
+        if (marker != '`') {
+            return pos + length;
+        }
+        
+        // A backslash escapes the first backtick of an opener
+        if (pos > 0 && text_[pos - 1] == '\\') {
+            ++pos;
+            if (--length == 0) {
+                return pos;
+            }
+        }
+        size_t close = find_span_close(pos + length, length);
+        return close == npos ? pos + length : close + length;
+    }
+
+private:
+    std::string_view text_;
+    std::vector<Document::Link>& links_;
+    std::vector<StructuralScanner::Tag>* tags_;
+    size_t open_ = npos;
+    size_t alias_ = npos;
+    
+    // Where the line holding the last position asked about starts, and its
+    // content after container markers. Positions only move forward, so a
+    // long line is walked back over once rather than once per fence-like run.
+    size_t line_ = 0;
+    size_t line_checked_ = 0;
+    size_t line_content_ = npos;
+    // The last failed search for a closing backtick run gave up at
+    // span_scan_end_ (a blank line, or the end of the text); last_run_ has
+    // where the last run of each length before there starts. Other openers
+    // up to there are answered from it, instead of each scanning again.
+    size_t span_scan_end_ = 0;
+    std::unordered_map<size_t, size_t> last_run_;
+    // The first newline at or after newline_from_, so that searches from
+    // within one long line don't each walk to its end
+    size_t newline_from_ = npos;
+    size_t newline_ = npos;
+    
+    // Only container markers (indentation, '>', a list marker) before `pos` on its line
+    bool starts_line(size_t pos) {
+        if (pos < line_checked_) {
+            line_ = BlockScanner::line_start(text_, pos);
+            line_content_ = npos;
+        } else if (size_t newline = text_.substr(line_checked_, pos - line_checked_).rfind('\n'); newline != npos) {
+            line_ = line_checked_ + newline + 1;
+            line_content_ = npos;
+        }
+        line_checked_ = pos;
+        if (line_content_ == npos) {
+            size_t content = BlockScanner::skip_container_prefix(text_, line_);
+            line_content_ = BlockScanner::skip_container_prefix(text_, BlockScanner::skip_list_marker(text_, content));
+        }
+        return line_content_ == pos;
+    }
+    
+    // Resumes after the closing fence line, or at the end of the text if
+    // the fence is never closed
+    size_t skip_fence(size_t opener_end, char marker, size_t length) {
+        open_ = npos;
+        for (size_t line = opener_end + 1; line < text_.size();) {
+            size_t end = BlockScanner::line_end(text_, line);
+            if (BlockScanner::is_closing_fence(text_, line, marker, length)) {
+                return end;
+            }
+            line = end + 1;
+        }
+        return text_.size();
+    }
+    
+    // Start of the next run of exactly `length` backticks at or after
+    // `from`, stopping at a blank line since spans don't cross paragraphs
+    size_t find_span_close(size_t from, size_t length) {
+        if (from < span_scan_end_) {
+            auto last = last_run_.find(length);
+            if (last == last_run_.end() || last->second < from) {
+                return npos;
+            }
+        }
+        
+        size_t stop = text_.size();
+        size_t newline = newline_at_or_after(from);
+        for (size_t pos = from; pos < text_.size();) {
+            size_t tick = text_.find('`', pos);
+            if (tick == npos) {
+                break;
+            }
+            for (; newline < tick; newline = text_.find('\n', newline + 1)) {
+                if (BlockScanner::is_blank_line(text_, newline + 1)) {
+                    stop = newline;
+                    break;
+                }
+            }
+            if (stop != text_.size()) {
+                break;
+            }
+            size_t run = run_length(text_, tick);
+            if (run == length) {
+                return tick;
+            }
+            pos = tick + run;
+        }
+        note_runs(from, stop);
+        return npos;
+    }
+    
+    size_t newline_at_or_after(size_t pos) {
+        if (newline_from_ == npos || pos < newline_from_ || (newline_ != npos && pos > newline_)) {
+            newline_ = text_.find('\n', pos);
+        }
+        newline_from_ = pos;
+        return newline_;
+    }
+    
+    // Notes the backtick runs between a failed search's start and where it gave up
+    void note_runs(size_t from, size_t stop) {
+        last_run_.clear();
+        for (size_t tick = text_.find('`', from); tick < stop; tick = text_.find('`', tick)) {
+            size_t run = run_length(text_, tick);
+            last_run_[run] = tick;
+            tick += run;
+        }
+        span_scan_end_ = stop;
+    }
+};
+
+// Structural positions in the 64-byte block at `pos`, bit i standing for
+// byte pos + i. Pairs and runs straddling the previous block are completed
+// by carrying in its last byte; the start of the text counts as a newline.
+template <typename Block>
+uint64_t find_structural(std::string_view text, size_t pos, uint64_t& open, uint64_t& close) {
+    const char* data = text.data() + pos;
+    char padded[64];
+    if (text.size() - pos < 64) {
+        std::memset(padded, 0, sizeof(padded));
+        std::memcpy(padded, data, text.size() - pos);
+        data = padded;
+    }
+    
+    // Most blocks of prose hold none of the characters at all
+    const Block block(data);
+    if (!block.any_of('[', ']', '|', '#', '`', '~')) {
+        open = close = 0;
+        return 0;
+    }
+    
+    const ByteMasks bytes = classify(block);
+    const unsigned char previous = pos > 0 ? static_cast<unsigned char>(text[pos - 1]) : '\n';
+    const uint64_t tag = bytes.hash & (bytes.whitespace << 1 | (previous <= ' '));
+    const uint64_t code = (bytes.backtick & ~(bytes.backtick << 1 | (previous == '`'))) |
+                          (bytes.tilde & ~(bytes.tilde << 1 | (previous == '~')));
+    open = bytes.open_bracket & (bytes.open_bracket << 1 | (previous == '['));
+    close = bytes.close_bracket & (bytes.close_bracket << 1 | (previous == ']'));
+    return open | close | bytes.pipe | tag | code;
+}
+
+// Stage one over [begin, end): writes the offsets from `begin` of every
+// structural byte to `out`, at most one per byte, and returns how many
+// there were. `pairs` is set to the smaller of the "[[" and "]]" counts.
+template <typename Block>
+size_t find_positions(std::string_view text, size_t begin, size_t end, uint32_t* out, size_t& pairs) {
+    uint32_t* next = out;
+    size_t opens = 0;
+    size_t closes = 0;
+    for (size_t pos = begin; pos < end; pos += 64) {
+        uint64_t open, close;
+        uint64_t structural = find_structural<Block>(text, pos, open, close);
+        opens += static_cast<size_t>(__builtin_popcountll(open));
+        closes += static_cast<size_t>(__builtin_popcountll(close));
+        const uint32_t offset = static_cast<uint32_t>(pos - begin);
+        while (structural) {
+            *next++ = offset + static_cast<uint32_t>(__builtin_ctzll(structural));
+            structural &= structural - 1;
+        }
+    }
+    pairs = std::min(opens, closes);
+    return static_cast<size_t>(next - out);
+}
+
+using FindPositions = size_t (*)(std::string_view, size_t, size_t, uint32_t*, size_t&);
+
+MDVIEWER_KERNEL_SCALAR size_t find_positions_scalar(std::string_view text, size_t begin, size_t end,
+                                                    uint32_t* out, size_t& pairs) {
+    return find_positions<simd::ScalarBlock>(text, begin, end, out, pairs);
+}
+
+#if defined(MDVIEWER_SIMD_X86)
+MDVIEWER_KERNEL_SSE42 size_t find_positions_sse42(std::string_view text, size_t begin, size_t end,
+                                                  uint32_t* out, size_t& pairs) {
+    return find_positions<simd::Sse42Block>(text, begin, end, out, pairs);
+}
+
+MDVIEWER_KERNEL_AVX2 size_t find_positions_avx2(std::string_view text, size_t begin, size_t end,
+                                                uint32_t* out, size_t& pairs) {
+    return find_positions<simd::Avx2Block>(text, begin, end, out, pairs);
+}
+
+MDVIEWER_KERNEL_AVX512 size_t find_positions_avx512(std::string_view text, size_t begin, size_t end,
+                                                    uint32_t* out, size_t& pairs) {
+    return find_positions<simd::Avx512Block>(text, begin, end, out, pairs);
+}
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+MDVIEWER_KERNEL_NEON size_t find_positions_neon(std::string_view text, size_t begin, size_t end,
+                                                uint32_t* out, size_t& pairs) {
+    return find_positions<simd::NeonBlock>(text, begin, end, out, pairs);
+}
+#endif
+
+FindPositions find_positions_for(SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        return find_positions_scalar;
+    }
+    switch (level) {
+#if defined(MDVIEWER_SIMD_X86)
+        case SimdLevel::SSE42:
+            return find_positions_sse42;
+        case SimdLevel::AVX2:
+            return find_positions_avx2;
+        case SimdLevel::AVX512:
+            return find_positions_avx512;
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+        case SimdLevel::NEON:
+            return find_positions_neon;
+#endif
+        default:
+            return find_positions_scalar;
+    }
+}
+
+// Stage one collects a window's structural positions before stage two
+// visits them; windows this size keep the positions in cache between the two
+constexpr size_t kWindowSize = 64 * 1024;
+
+void scan_windows(std::string_view text, std::vector<Document::Link>& links,
+                  std::vector<StructuralScanner::Tag>* tags, FindPositions find) {
+    Extractor extractor(text, links, tags);
+    // Room for the worst case of one position per byte, left uninitialised:
+    // prose only ever writes to the start of it
+    const size_t capacity = std::min(text.size(), kWindowSize) + 64;
+    std::unique_ptr<uint32_t[]> positions(new uint32_t[capacity]);
+    
+    size_t window = 0;
+    while (window < text.size()) {
+        const size_t window_end = std::min(window + kWindowSize, text.size());
+        size_t pairs = 0;
+        const size_t count = find(text, window, window_end, positions.get(), pairs);
+        
+        // The first window's share of links is extrapolated over the next
+        // megabyte or so to size `links` once for typical notes, without
+        // reserving much for a dense opening
+        if (window == 0) {
+            pairs = pairs * std::min(text.size(), 16 * kWindowSize) / window_end;
+        }
+        extractor.expect_links(pairs);
+        
+        // Each structural byte says what it is; only code moves `resume`
+        // past positions that are then skipped
+        size_t resume = window;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t at = window + positions[i];
+            if (at < resume) {
+                continue;
+            }
+            switch (text[at]) {
+                case '[':
+                    extractor.open_link(at);
+                    break;
+                case ']':
+                    extractor.close_link(at);
+                    break;
+                case '|':
+                    extractor.pipe(at);
+                    break;
+                case '#':
+                    extractor.tag(at);
+                    break;
+                default:
+                    resume = extractor.code(at);
+                    break;
+            }
+        }
+        window = std::max(window_end, resume);
+    }
+}
+
+} // namespace
+
+void StructuralScanner::scan(std::string_view text, std::vector<Document::Link>& links, std::vector<Tag>* tags) {
+    static const FindPositions find = find_positions_for(SimdDispatch::active());
+    scan_windows(text, links, tags, find);
+}
+
+void StructuralScanner::scan(std::string_view text, std::vector<Document::Link>& links, std::vector<Tag>* tags,
+                             SimdLevel level) {
+    scan_windows(text, links, tags, find_positions_for(level));
+}
+
+} // namespace mdviewer
@@ -0,0 +1,305 @@
+#include "core/text_counter.h"
+#include "simd_block.h"
+#include <cstdint>
+
+namespace mdviewer {
+
+namespace {
+
+using Counts = TextCounter::Counts;
+
+constexpr uint32_t kMalformed = 0xFFFFFFFF;
+
+bool in(uint32_t cp, uint32_t first, uint32_t last) {
+    return cp >= first && cp <= last;
+}
+
+// White_Space, zero width space, and the CJK and fullwidth punctuation
+// that separates words in text written without spaces
+bool is_separator(uint32_t cp) {
+    return in(cp, 0x09, 0x0D) || cp == 0x20 || cp == 0x85 || cp == 0xA0 || cp == 0x1680 ||
+           in(cp, 0x2000, 0x200B) || cp == 0x2028 || cp == 0x2029 || cp == 0x202F || cp == 0x205F ||
+           in(cp, 0x3000, 0x3003) || in(cp, 0x3008, 0x3011) || in(cp, 0x3014, 0x301F) ||
+           cp == 0xFF01 || cp == 0xFF08 || cp == 0xFF09 || cp == 0xFF0C || cp == 0xFF0E ||
+           cp == 0xFF1A || cp == 0xFF1B || cp == 0xFF1F;
+}
+
+// Han, Hiragana and Katakana, each of which counts as a word
+bool is_ideograph(uint32_t cp) {
+    return in(cp, 0x3005, 0x3007) || in(cp, 0x3040, 0x30FF) || in(cp, 0x31F0, 0x31FF) ||
+           in(cp, 0x3400, 0x4DBF) || in(cp, 0x4E00, 0x9FFF) || in(cp, 0xF900, 0xFAFF) ||
+           in(cp, 0xFF66, 0xFF9F) || in(cp, 0x20000, 0x3FFFF);
+}
+
+// Combining marks, joiners, variation selectors, skin tone modifiers and
+// tag characters: part of the character before them
+bool is_extender(uint32_t cp) {
+    return in(cp, 0x0300, 0x036F) || in(cp, 0x1AB0, 0x1AFF) || in(cp, 0x1DC0, 0x1DFF) ||
+           in(cp, 0x200C, 0x200D) || in(cp, 0x20D0, 0x20FF) || in(cp, 0x3099, 0x309A) ||
+           in(cp, 0xFE00, 0xFE0F) || in(cp, 0xFE20, 0xFE2F) || in(cp, 0x1F3FB, 0x1F3FF) ||
+           in(cp, 0xE0020, 0xE007F) || in(cp, 0xE0100, 0xE01EF);
+}
+
+// Symbols that a ZWJ joins into one emoji
+bool is_pictographic(uint32_t cp) {
+    return in(cp, 0x2600, 0x27BF) || in(cp, 0x2B00, 0x2BFF) || in(cp, 0x1F000, 0x1FAFF);
+}
+
+bool is_regional_indicator(uint32_t cp) {
+    return in(cp, 0x1F1E6, 0x1F1FF);
+}
+
+// A codepoint whose counts don't depend on its neighbours: one character,
+// and a word byte for every byte of it
+bool is_plain(uint32_t cp) {
+    return !is_separator(cp) && !is_ideograph(cp) && !is_extender(cp) && !is_pictographic(cp) &&
+           !is_regional_indicator(cp);
+}
+
+bool is_continuation(char c) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+// Decodes the sequence starting at `pos`, which isn't a continuation
+// byte, setting `length` to the bytes it takes. Truncated sequences and
+// invalid lead bytes decode to kMalformed.
+uint32_t decode(std::string_view text, size_t pos, size_t& length) {
+    const unsigned char lead = text[pos];
+    length = 1;
+    if (lead < 0x80) {
+        return lead;
+    }
+    size_t needed;
+    uint32_t cp;
+    if (lead < 0xE0) {
+        needed = 1;
+        cp = lead & 0x1F;
+    } else if (lead < 0xF0) {
+        needed = 2;
+        cp = lead & 0x0F;
+    } else if (lead < 0xF8) {
+        needed = 3;
+        cp = lead & 0x07;
+    } else {
+        return kMalformed;
+    }
+    while (length <= needed && pos + length < text.size() && is_continuation(text[pos + length])) {
+        cp = cp << 6 | (static_cast<unsigned char>(text[pos + length]) & 0x3F);
+        ++length;
+    }
+    return length == needed + 1 ? cp : kMalformed;
+}
+
+// What the codepoints counted so far leave behind for the next one
+struct CountState {
+    bool in_word = false;
+    bool after_cr = false;
+    bool after_zwj = false;
+    bool odd_regional_indicator = false;  // a flag's first half
+};
+
+void count_codepoint(uint32_t cp, CountState& state, Counts& counts) {
+    ++counts.codepoints;
+    const bool regional_indicator = is_regional_indicator(cp);
+    if (is_extender(cp)) {
+        // Attaches to the previous character and leaves the word as it is
+    } else {
+        const bool continues_character = (cp == '\n' && state.after_cr) ||
+                                         (state.after_zwj && is_pictographic(cp)) ||
+                                         (regional_indicator && state.odd_regional_indicator);
+        counts.characters += !continues_character;
+        if (is_separator(cp)) {
+            state.in_word = false;
+        } else if (is_ideograph(cp)) {
+            ++counts.words;
+            state.in_word = false;
+        } else {
+            counts.words += !state.in_word;
+            state.in_word = true;
+        }
+    }
+    state.after_cr = cp == '\r';
+    state.after_zwj = cp == 0x200D;
+    state.odd_regional_indicator = regional_indicator && !state.odd_regional_indicator;
+}
+
+// The reference: decodes and counts every sequence starting in [pos,
+// until), returning where the last one ends. Continuation bytes with no
+// sequence to belong to are skipped.
+size_t count_sequences(std::string_view text, size_t pos, size_t until, CountState& state, Counts& counts) {
+    while (pos < until) {
+        if (is_continuation(text[pos])) {
+            ++pos;
+            continue;
+        }
+        size_t length;
+        count_codepoint(decode(text, pos, length), state, counts);
+        pos += length;
+    }
+    return pos;
+}
+
+uint64_t popcount(uint64_t mask) {
+    return static_cast<uint64_t>(__builtin_popcountll(mask));
+}
+
+// Most text is ASCII with the odd accented letter, symbol or typographic
+// quote, and each of those codepoints is one character made of word
+// bytes. A block holding nothing else is counted straight from masks:
+// words start at word bytes after a separator, codepoints at bytes that
+// aren't continuations, and a character at each of them except the LF of
+// CR LF. The plain codepoints recognised this way are U+0080-U+07FF
+// bar U+0085, U+00A0 and the combining marks at U+0300-U+036F, plus
+// U+2010-U+2027 and U+2030-U+203E (dashes, curly quotes, ellipsis).
+// Blocks with anything else, malformed sequences included, go through
+// the reference.
+template <typename Block>
+Counts count_blocks(std::string_view text) {
+    Counts counts;
+    CountState state;
+    // Lead bytes of the previous block, for sequences that run into this one
+    uint64_t previous_two_byte = 0;
+    uint64_t previous_three_byte = 0;
+    uint64_t previous_c2 = 0;
+    size_t pos = 0;
+    while (pos + 64 <= text.size()) {
+        const Block block(text.data() + pos);
+        const uint64_t ascii = block.at_most(0x7F);
+        const uint64_t carried = previous_two_byte >> 63 | previous_three_byte >> 62;
+        uint64_t continuation = 0;
+        uint64_t two_byte = 0;
+        uint64_t three_byte = 0;
+        uint64_t c2 = 0;
+        bool plain = true;
+        if (~ascii || carried) {
+            continuation = block.at_most(static_cast<char>(0xBF)) & ~ascii;
+            const uint64_t leads = ~ascii & ~continuation;
+            two_byte = leads & ~block.at_most(static_cast<char>(0xC1)) & block.at_most(static_cast<char>(0xDF)) &
+                       ~(block.at_most(static_cast<char>(0xCD)) & ~block.at_most(static_cast<char>(0xCB)));
+            three_byte = block.eq(static_cast<char>(0xE2));
+            c2 = block.eq(static_cast<char>(0xC2));
+            
+            const uint64_t second_of_two = two_byte << 1 | previous_two_byte >> 63;
+            const uint64_t second_of_three = three_byte << 1 | previous_three_byte >> 63;
+            const uint64_t third_of_three = three_byte << 2 | previous_three_byte >> 62;
+            const uint64_t after_c2 = c2 << 1 | previous_c2 >> 63;
+            const uint64_t plain_third = (block.at_most(static_cast<char>(0xA7)) & ~block.at_most(static_cast<char>(0x8F))) |
+                                         (block.at_most(static_cast<char>(0xBE)) & ~block.at_most(static_cast<char>(0xAF)));
+            plain = leads == (two_byte | three_byte) &&
+                    continuation == (second_of_two | second_of_three | third_of_three) &&
+                    !(second_of_three & ~block.eq(static_cast<char>(0x80))) && !(third_of_three & ~plain_third) &&
+                    !(after_c2 & (block.eq(static_cast<char>(0x85)) | block.eq(static_cast<char>(0xA0))));
+            
+            // A sequence running into the next block is checked by decoding it
+            size_t straddling = 0;
+            if ((two_byte | three_byte) >> 63) {
+                straddling = pos + 63;
+            } else if (three_byte >> 62) {
+                straddling = pos + 62;
+            }
+            if (plain && straddling) {
+                size_t length;
+                plain = is_plain(decode(text, straddling, length));
+            }
+        }
+        
+        if (!plain) {
+            pos = count_sequences(text, pos, pos + 64, state, counts);
+            previous_two_byte = previous_three_byte = previous_c2 = 0;
+            continue;
+        }
+        
+        const uint64_t separators = (block.at_most('\r') & ~block.at_most('\b')) | block.eq(' ');
+        const uint64_t in_word = ~separators;
+        counts.words += popcount(in_word & ~(in_word << 1 | uint64_t{state.in_word}));
+        
+        const uint64_t codepoints = 64 - popcount(continuation);
+        const uint64_t cr = block.eq('\r');
+        uint64_t crlf = 0;
+        if (cr || state.after_cr) {
+            crlf = popcount(block.eq('\n') & (cr << 1 | uint64_t{state.after_cr}));
+        }
+        counts.codepoints += codepoints;
+        counts.characters += codepoints - crlf;
+        
+        state = CountState{in_word >> 63 != 0, cr >> 63 != 0, false, false};
+        previous_two_byte = two_byte;
+        previous_three_byte = three_byte;
+        previous_c2 = c2;
+        pos += 64;
+    }
+    count_sequences(text, pos, text.size(), state, counts);
+    return counts;
+}
+
+using CountText = Counts (*)(std::string_view);
+
+MDVIEWER_KERNEL_SCALAR Counts count_reference(std::string_view text) {
+    Counts counts;
+    CountState state;
+    count_sequences(text, 0, text.size(), state, counts);
+    return counts;
+}
+
+#if defined(MDVIEWER_SIMD_X86)
+MDVIEWER_KERNEL_SSE42 Counts count_sse42(std::string_view text) {
+    return count_blocks<simd::Sse42Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX2 Counts count_avx2(std::string_view text) {
+    return count_blocks<simd::Avx2Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX512 Counts count_avx512(std::string_view text) {
+    return count_blocks<simd::Avx512Block>(text);
+}
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+MDVIEWER_KERNEL_NEON Counts count_neon(std::string_view text) {
+    return count_blocks<simd::NeonBlock>(text);
+}
+#endif
+
+CountText count_for(SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        return count_reference;
+    }
+    switch (level) {
+#if defined(MDVIEWER_SIMD_X86)
+        case SimdLevel::SSE42:
+            return count_sse42;
+        case SimdLevel::AVX2:
+            return count_avx2;
+        case SimdLevel::AVX512:
+            return count_avx512;
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+        case SimdLevel::NEON:
+            return count_neon;
+#endif
+        default:
+            return count_reference;
+    }
+}
+
+} // namespace
+
+TextCounter::Counts TextCounter::count(std::string_view text) {
+    static const CountText count = count_for(SimdDispatch::active());
+    return count(text);
+}
+
+TextCounter::Counts TextCounter::count(std::string_view text, SimdLevel level) {
+    return count_for(level)(text);
+}
+
+size_t TextCounter::count_words(std::string_view text) {
+    return count(text).words;
+}
+
+size_t TextCounter::count_words(std::string_view text, SimdLevel level) {
+    return count(text, level).words;
+}
+
+} // namespace mdviewer
@@ -0,0 +1,267 @@
+#include "core/text_offset_map.h"
+#include "simd_block.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace mdviewer {
+
+namespace {
+
+// Bytes between checkpoints. A scan never leaves a last interval shorter
+// than half of this; it joins the one before instead.
+constexpr size_t kInterval = 1024;
+
+// What a run of bytes adds to each count
+struct Tally {
+    size_t utf16 = 0;
+    size_t codepoints = 0;
+    size_t lines = 0;
+};
+
+bool is_continuation(unsigned char byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+// UTF-16 units for the sequence `lead` starts; 0 for a continuation byte
+size_t utf16_width(unsigned char lead) {
+    return is_continuation(lead) ? 0 : lead >= 0xF0 ? 2 : 1;
+}
+
+void tally_bytes(const char* data, size_t length, Tally& tally) {
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned char byte = data[i];
+        const size_t width = utf16_width(byte);
+        tally.utf16 += width;
+        tally.codepoints += width != 0;
+        tally.lines += byte == '\n';
+    }
+}
+
+uint64_t popcount(uint64_t mask) {
+    return static_cast<uint64_t>(__builtin_popcountll(mask));
+}
+
+// Every count is a sum over bytes, so a block is counted from three masks
+// with nothing carried between blocks
+template <typename Block>
+Tally tally_blocks(const char* data, size_t length) {
+    Tally tally;
+    size_t pos = 0;
+    while (pos + 64 <= length) {
+        const Block block(data + pos);
+        const uint64_t ascii = block.at_most(0x7F);
+        uint64_t codepoints = 64;
+        if (~ascii) {
+            const uint64_t continuation = block.at_most(static_cast<char>(0xBF)) & ~ascii;
+            const uint64_t four_byte = ~block.at_most(static_cast<char>(0xEF));
+            codepoints -= popcount(continuation);
+            tally.utf16 += popcount(four_byte);
+        }
+        tally.codepoints += codepoints;
+        tally.utf16 += codepoints;
+        tally.lines += popcount(block.eq('\n'));
+        pos += 64;
+    }
+    tally_bytes(data + pos, length - pos, tally);
+    return tally;
+}
+
+using TallyText = Tally (*)(const char*, size_t);
+
+MDVIEWER_KERNEL_SCALAR Tally tally_reference(const char* data, size_t length) {
+    Tally tally;
+    tally_bytes(data, length, tally);
+    return tally;
+}
+
+#if defined(MDVIEWER_SIMD_X86)
+MDVIEWER_KERNEL_SSE42 Tally tally_sse42(const char* data, size_t length) {
+    return tally_blocks<simd::Sse42Block>(data, length);
+}
+
+MDVIEWER_KERNEL_AVX2 Tally tally_avx2(const char* data, size_t length) {
+    return tally_blocks<simd::Avx2Block>(data, length);
+}
+
+MDVIEWER_KERNEL_AVX512 Tally tally_avx512(const char* data, size_t length) {
+    return tally_blocks<simd::Avx512Block>(data, length);
+}
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+MDVIEWER_KERNEL_NEON Tally tally_neon(const char* data, size_t length) {
+    return tally_blocks<simd::NeonBlock>(data, length);
+}
+#endif
+
+TallyText tally_for(SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        return tally_reference;
+    }
+    switch (level) {
+#if defined(MDVIEWER_SIMD_X86)
+        case SimdLevel::SSE42:
+            return tally_sse42;
+        case SimdLevel::AVX2:
+            return tally_avx2;
+        case SimdLevel::AVX512:
+            return tally_avx512;
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+        case SimdLevel::NEON:
+            return tally_neon;
+#endif
+        default:
+            return tally_reference;
+    }
+}
+
+} // namespace
+
+TextOffsetMap::TextOffsetMap() : TextOffsetMap(std::string_view()) {}
+
+TextOffsetMap::TextOffsetMap(std::string_view text) : TextOffsetMap(text, SimdDispatch::active()) {}
+
+TextOffsetMap::TextOffsetMap(std::string_view text, SimdLevel level) : text_(text), level_(level) {
+    checkpoints_.reserve(text.size() / kInterval + 2);
+    checkpoints_.push_back(scan({}, text.size(), checkpoints_));
+}
+
+TextOffsetMap::Checkpoint TextOffsetMap::scan(Checkpoint from, size_t end, std::vector<Checkpoint>& out) const {
+    const TallyText tally = tally_for(level_);
+    Checkpoint at = from;
+    for (;;) {
+        out.push_back(at);
+        size_t until = end - at.byte <= kInterval + kInterval / 2 ? end : at.byte + kInterval;
+        const Tally added = tally(text_.data() + at.byte, until - at.byte);
+        at = {until, at.utf16 + added.utf16, at.codepoints + added.codepoints, at.lines + added.lines};
+        if (until == end) {
+            return at;
+        }
+    }
+}
+
+void TextOffsetMap::update(std::string_view text, size_t offset, size_t removed_len, size_t inserted_len) {
+    const size_t old_size = text_.size();
+    offset = std::min(offset, old_size);
+    removed_len = std::min(removed_len, old_size - offset);
+    // Unsigned wraparound makes this a subtraction when text was removed
+    const size_t shift = inserted_len - removed_len;
+    text_ = text;
+
+    // Counts before the last checkpoint ahead of the edit still hold, and
+    // those from the first one past it on only move. Rescan between them,
+    // taking in the next interval too when that span is short, so that
+    // repeated edits don't wear the intervals down.
+    auto by_byte = [](size_t byte, const Checkpoint& checkpoint) { return byte < checkpoint.byte; };
+    size_t first = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), offset, by_byte) -
+                   checkpoints_.begin() - 1;
+    if (first > 0 && checkpoints_[first].byte == offset) {
+        --first;
+    }
+    size_t last = std::lower_bound(checkpoints_.begin(), checkpoints_.end(), offset + removed_len,
+                                   [](const Checkpoint& checkpoint, size_t byte) { return checkpoint.byte < byte; }) -
+                  checkpoints_.begin();
+    if (last + 1 < checkpoints_.size() && checkpoints_[last].byte + shift - checkpoints_[first].byte < kInterval) {
+        ++last;
+    }
+
+    std::vector<Checkpoint> rescanned;
+    const Checkpoint old = checkpoints_[last];
+    const Checkpoint resumed = scan(checkpoints_[first], old.byte + shift, rescanned);
+    for (size_t i = last; i < checkpoints_.size(); ++i) {
+        Checkpoint& checkpoint = checkpoints_[i];
+        checkpoint.byte += shift;
+        checkpoint.utf16 += resumed.utf16 - old.utf16;
+        checkpoint.codepoints += resumed.codepoints - old.codepoints;
+        checkpoint.lines += resumed.lines - old.lines;
+    }
+    checkpoints_.erase(checkpoints_.begin() + first, checkpoints_.begin() + last);
+    checkpoints_.insert(checkpoints_.begin() + first, rescanned.begin(), rescanned.end());
+}
+
+const TextOffsetMap::Checkpoint& TextOffsetMap::checkpoint_at(size_t Checkpoint::*field, size_t value) const {
+    auto it = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), value,
+                               [field](size_t value, const Checkpoint& checkpoint) { return value < checkpoint.*field; });
+    return *(it - 1);
+}
+
+TextOffsetMap::Checkpoint TextOffsetMap::counts_at(size_t byte) const {
+    byte = std::min(byte, text_.size());
+    const Checkpoint& checkpoint = checkpoint_at(&Checkpoint::byte, byte);
+    const Tally added = tally_for(level_)(text_.data() + checkpoint.byte, byte - checkpoint.byte);
+    return {byte, checkpoint.utf16 + added.utf16, checkpoint.codepoints + added.codepoints,
+            checkpoint.lines + added.lines};
+}
+
+size_t TextOffsetMap::utf16_from_byte(size_t byte) const {
+    return counts_at(byte).utf16;
+}
+
+size_t TextOffsetMap::codepoint_from_byte(size_t byte) const {
+    return counts_at(byte).codepoints;
+}
+
+size_t TextOffsetMap::byte_from_utf16(size_t unit) const {
+    const Checkpoint& checkpoint = checkpoint_at(&Checkpoint::utf16, unit);
+    size_t count = checkpoint.utf16;
+    for (size_t pos = checkpoint.byte; pos < text_.size(); ++pos) {
+        const size_t width = utf16_width(text_[pos]);
+        if (width != 0 && count + width > unit) {
+            return pos;
+        }
+        count += width;
+    }
+    return text_.size();
+}
+
+size_t TextOffsetMap::byte_from_codepoint(size_t codepoint) const {
+    const Checkpoint& checkpoint = checkpoint_at(&Checkpoint::codepoints, codepoint);
+    size_t count = checkpoint.codepoints;
+    for (size_t pos = checkpoint.byte; pos < text_.size(); ++pos) {
+        if (!is_continuation(text_[pos]) && count++ == codepoint) {
+            return pos;
+        }
+    }
+    return text_.size();
+}
+
+size_t TextOffsetMap::line_start(size_t line) const {
+    if (line == 0) {
+        return 0;
+    }
+    if (line >= line_count()) {
+        return text_.size();
+    }
+    // The checkpoint before the newline that ends the line before
+    const Checkpoint& checkpoint = checkpoint_at(&Checkpoint::lines, line - 1);
+    size_t remaining = line - checkpoint.lines;
+    const char* pos = text_.data() + checkpoint.byte;
+    const char* end = text_.data() + text_.size();
+    for (;;) {
+        pos = static_cast<const char*>(std::memchr(pos, '\n', end - pos)) + 1;
+        if (--remaining == 0) {
+            return pos - text_.data();
+        }
+    }
+}
+
+TextOffsetMap::LineColumn TextOffsetMap::line_column_from_byte(size_t byte) const {
+    const Checkpoint counts = counts_at(byte);
+    return {counts.lines, counts.utf16 - utf16_from_byte(line_start(counts.lines))};
+}
+
+size_t TextOffsetMap::byte_from_line_column(LineColumn position) const {
+    if (position.line >= line_count()) {
+        return text_.size();
+    }
+    const size_t start = line_start(position.line);
+    const size_t byte = byte_from_utf16(utf16_from_byte(start) + position.column);
+    if (position.line + 1 < line_count()) {
+        return std::min(byte, line_start(position.line + 1) - 1);
+    }
+    return byte;
+}
+
+} // namespace mdviewer
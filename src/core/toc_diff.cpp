@@ -0,0 +1,214 @@
+#include "core/toc_diff.h"
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace mdviewer {
+
+namespace {
+
+constexpr size_t npos = TOCDiff::npos;
+
+// Level and text, which a heading keeps for as long as it's the same one
+bool same_identity(const TOCDiff::Entry& a, const TOCDiff::Entry& b) {
+    return a.level == b.level && a.text == b.text;
+}
+
+size_t identity_hash(const TOCDiff::Entry& entry) {
+    return std::hash<std::string_view>{}(entry.text) ^ static_cast<size_t>(entry.level);
+}
+
+// Marks the siblings in `group`, given in new order, that aren't part of a
+// longest run whose old indexes increase: the fewest moves that restore
+// the new order
+void mark_reordered(std::span<const size_t> group, const std::vector<size_t>& matches, std::vector<bool>& moved) {
+    auto old_index = [&](size_t position) { return matches[group[position]]; };
+    
+    bool in_order = true;
+    for (size_t position = 1; position < group.size() && in_order; ++position) {
+        in_order = old_index(position - 1) < old_index(position);
+    }
+    if (in_order) {
+        return;
+    }
+    
+    // tails[k] ends the increasing run of length k + 1 with the smallest
+    // last old index; previous links each position to the one before it
+    std::vector<size_t> tails;
+    std::vector<size_t> previous(group.size(), npos);
+    for (size_t position = 0; position < group.size(); ++position) {
+        auto tail = std::lower_bound(tails.begin(), tails.end(), old_index(position),
+                                     [&](size_t other, size_t value) { return old_index(other) < value; });
+        if (tail != tails.begin()) {
+            previous[position] = *(tail - 1);
+        }
+        if (tail == tails.end()) {
+            tails.push_back(position);
+        } else {
+            *tail = position;
+        }
+    }
+    
+    std::vector<bool> kept(group.size(), false);
+    for (size_t position = tails.back(); position != npos; position = previous[position]) {
+        kept[position] = true;
+    }
+    for (size_t position = 0; position < group.size(); ++position) {
+        if (!kept[position]) {
+            moved[group[position]] = true;
+        }
+    }
+}
+
+} // namespace
+
+std::vector<TOCDiff::Flat> TOCDiff::flatten(const Document::TableOfContents& toc) {
+    std::vector<Flat> flat;
+    std::vector<Flat> pending;
+    for (size_t sibling = toc.entries.size(); sibling-- > 0;) {
+        pending.push_back({&toc.entries[sibling], npos, sibling});
+    }
+    while (!pending.empty()) {
+        Flat next = pending.back();
+        pending.pop_back();
+        
+        const size_t index = flat.size();
+        flat.push_back(next);
+        const auto& children = next.entry->children;
+        for (size_t sibling = children.size(); sibling-- > 0;) {
+            pending.push_back({&children[sibling], index, sibling});
+        }
+    }
+    return flat;
+}
+
+TOCDiff::Script TOCDiff::compute(const Document::TableOfContents& before, const Document::TableOfContents& after) {
+    const std::vector<Flat> old_flat = flatten(before);
+    const std::vector<Flat> new_flat = flatten(after);
+    const size_t old_count = old_flat.size();
+    const size_t new_count = new_flat.size();
+    
+    Script script;
+    script.matches.assign(new_count, npos);
+    std::vector<size_t> old_matches(old_count, npos);
+    
+    // The k-th heading with an identity continues the k-th old one. Old
+    // entries are indexed by identity in an open-addressed table holding
+    // the first entry with each; the others follow it through next_same,
+    // and cursor holds the next one to match.
+    size_t capacity = 16;
+    while (capacity < old_count * 2) {
+        capacity *= 2;
+    }
+    std::vector<size_t> slots(capacity, npos);
+    std::vector<size_t> next_same(old_count, npos);
+    std::vector<size_t> last_same(old_count, npos);
+    std::vector<size_t> cursor(old_count, npos);
+    auto slot_for = [&](const Entry& entry) -> size_t& {
+        size_t slot = identity_hash(entry) & (capacity - 1);
+        while (slots[slot] != npos && !same_identity(*old_flat[slots[slot]].entry, entry)) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        return slots[slot];
+    };
+    for (size_t index = 0; index < old_count; ++index) {
+        size_t& first = slot_for(*old_flat[index].entry);
+        if (first == npos) {
+            first = index;
+            cursor[index] = index;
+        } else {
+            next_same[last_same[first]] = index;
+        }
+        last_same[first] = index;
+    }
+    for (size_t index = 0; index < new_count; ++index) {
+        const size_t first = slot_for(*new_flat[index].entry);
+        if (first != npos && cursor[first] != npos) {
+            const size_t old_index = cursor[first];
+            cursor[first] = next_same[old_index];
+            script.matches[index] = old_index;
+            old_matches[old_index] = index;
+        }
+    }
+    
+    // An unmatched heading right after a match, or at the start, takes the
+    // place of an unmatched one of its level right after the old match
+    std::vector<bool> retitled(new_count, false);
+    for (size_t index = 0; index < new_count; ++index) {
+        if (script.matches[index] != npos) {
+            continue;
+        }
+        size_t candidate = 0;
+        if (index > 0) {
+            candidate = script.matches[index - 1] == npos ? npos : script.matches[index - 1] + 1;
+        }
+        if (candidate < old_count && old_matches[candidate] == npos &&
+            old_flat[candidate].entry->level == new_flat[index].entry->level) {
+            script.matches[index] = candidate;
+            old_matches[candidate] = index;
+            retitled[index] = old_flat[candidate].entry->text != new_flat[index].entry->text;
+        }
+    }
+    
+    // Matched headings under the counterpart of their old parent keep
+    // their place unless their siblings were reordered; the rest moved.
+    // Those that stayed are grouped by parent, the top level last.
+    std::vector<bool> moved(new_count, false);
+    std::vector<size_t> group_of(new_count, npos);
+    std::vector<size_t> group_start(new_count + 2, 0);
+    for (size_t index = 0; index < new_count; ++index) {
+        const size_t old_index = script.matches[index];
+        if (old_index == npos) {
+            continue;
+        }
+        const size_t parent = new_flat[index].parent;
+        const size_t old_parent = old_flat[old_index].parent;
+        const bool same_parent = parent == npos ? old_parent == npos
+                                                : old_parent != npos && script.matches[parent] == old_parent;
+        if (same_parent) {
+            group_of[index] = parent == npos ? new_count : parent;
+            ++group_start[group_of[index] + 1];
+        } else {
+            moved[index] = true;
+        }
+    }
+    for (size_t group = 1; group < group_start.size(); ++group) {
+        group_start[group] += group_start[group - 1];
+    }
+    std::vector<size_t> grouped(group_start.back());
+    std::vector<size_t> filled(group_start.begin(), group_start.end() - 1);
+    for (size_t index = 0; index < new_count; ++index) {
+        if (group_of[index] != npos) {
+            grouped[filled[group_of[index]]++] = index;
+        }
+    }
+    for (size_t group = 0; group + 1 < group_start.size(); ++group) {
+        const size_t size = group_start[group + 1] - group_start[group];
+        if (size > 1) {
+            mark_reordered(std::span<const size_t>(grouped).subspan(group_start[group], size), script.matches, moved);
+        }
+    }
+    
+    for (size_t old_index = old_count; old_index-- > 0;) {
+        if (old_matches[old_index] == npos) {
+            script.changes.push_back({Change::Kind::Remove, old_index, npos});
+        }
+    }
+    for (size_t index = 0; index < new_count; ++index) {
+        const size_t old_index = script.matches[index];
+        if (old_index == npos) {
+            script.changes.push_back({Change::Kind::Insert, npos, index});
+            continue;
+        }
+        if (moved[index]) {
+            script.changes.push_back({Change::Kind::Move, old_index, index});
+        }
+        if (retitled[index]) {
+            script.changes.push_back({Change::Kind::Retitle, old_index, index});
+        }
+    }
+    return script;
+}
+
+} // namespace mdviewer
@@ -1,52 +1,504 @@
 #include "core/toc_generator.h"
-#include <regex>
+#include "core/block_scanner.h"
+#include <algorithm>
+#include <cctype>
+#include <map>
 
 namespace mdviewer {
 
-TOCGenerator::TOC TOCGenerator::generate(const std::string& markdown) {
-    TOC toc;
+namespace {
+
+constexpr size_t npos = std::string_view::npos;
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool is_word_char(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || static_cast<unsigned char>(c) >= 0x80;
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && is_space(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && is_space(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+size_t run_length(std::string_view text, size_t pos) {
+    size_t end = pos;
+    while (end < text.size() && text[end] == text[pos]) {
+        ++end;
+    }
+    return end - pos;
+}
+
+// Where a line's content starts: after up to three spaces of indentation
+// and any blockquote markers. `indent` is set to the indentation found
+// before the content, which is four or more for indented code.
+size_t content_start(std::string_view text, size_t line, size_t end, size_t& indent) {
+    size_t pos = line;
+    for (;;) {
+        size_t spaces = 0;
+        while (pos < end && (text[pos] == ' ' || text[pos] == '\t')) {
+            spaces += text[pos] == '\t' ? 4 : 1;
+            ++pos;
+        }
+        indent = spaces;
+        if (spaces >= 4 || pos >= end || text[pos] != '>') {
+            return pos;
+        }
+        ++pos;
+    }
+}
+
+// ATX heading level for the content at `pos`, or 0
+int atx_level(std::string_view text, size_t pos, size_t end) {
+    size_t hashes = 0;
+    while (pos + hashes < end && text[pos + hashes] == '#') {
+        ++hashes;
+    }
+    if (hashes == 0 || hashes > 6 || (pos + hashes < end && !is_space(text[pos + hashes]))) {
+        return 0;
+    }
+    return static_cast<int>(hashes);
+}
+
+// The title of an ATX heading, without its optional closing run of '#'
+std::string_view atx_title(std::string_view line) {
+    std::string_view title = trim(line);
+    size_t hashes = title.size();
+    while (hashes > 0 && title[hashes - 1] == '#') {
+        --hashes;
+    }
+    if (hashes == 0 || is_space(title[hashes - 1])) {
+        title = trim(title.substr(0, hashes));
+    }
+    return title;
+}
+
+// 1 for a line of '=', 2 for a line of '-', 0 otherwise
+int setext_level(std::string_view text, size_t pos, size_t end) {
+    if (pos >= end || (text[pos] != '=' && text[pos] != '-')) {
+        return 0;
+    }
+    size_t run = run_length(text.substr(0, end), pos);
+    return trim(text.substr(pos + run, end - pos - run)).empty() ? (text[pos] == '=' ? 1 : 2) : 0;
+}
+
+// "***", "- - -", "___": a thematic break, which ends a paragraph
+bool is_thematic_break(std::string_view text, size_t pos, size_t end) {
+    if (pos >= end || (text[pos] != '*' && text[pos] != '-' && text[pos] != '_')) {
+        return false;
+    }
+    char marker = text[pos];
+    size_t count = 0;
+    for (; pos < end; ++pos) {
+        if (text[pos] == marker) {
+            ++count;
+        } else if (!is_space(text[pos])) {
+            return false;
+        }
+    }
+    return count >= 3;
+}
+
+// Opening code fence at `pos`: sets its character and length
+bool opens_fence(std::string_view text, size_t pos, size_t end, char& fence_char, size_t& fence_length) {
+    if (pos >= end || (text[pos] != '`' && text[pos] != '~')) {
+        return false;
+    }
+    size_t run = run_length(text.substr(0, end), pos);
+    if (run < 3) {
+        return false;
+    }
+    // A backtick fence's info string can't hold backticks
+    if (text[pos] == '`' && text.substr(pos + run, end - pos - run).find('`') != npos) {
+        return false;
+    }
+    fence_char = text[pos];
+    fence_length = run;
+    return true;
+}
+
+// The closing bracket or parenthesis for each opener, paired in one pass
+// over the text so that a run of unmatched openers doesn't rescan the rest
+// of the line once per opener. Backslash escapes are skipped.
+class Brackets {
+public:
+    explicit Brackets(std::string_view text) {
+        std::vector<size_t> squares;
+        std::vector<size_t> parens;
+        for (size_t pos = 0; pos < text.size(); ++pos) {
+            std::vector<size_t>* open = nullptr;
+            switch (text[pos]) {
+                case '\\':
+                    ++pos;
+                    continue;
+                case '[':
+                case '(':
+                    (text[pos] == '[' ? squares : parens).push_back(pairs_.size());
+                    pairs_.push_back({pos, npos});
+                    continue;
+                case ']':
+                    open = &squares;
+                    break;
+                case ')':
+                    open = &parens;
+                    break;
+                default:
+                    continue;
+            }
+            if (!open->empty()) {
+                pairs_[open->back()].close = pos;
+                open->pop_back();
+            }
+        }
+    }
     
-    if (markdown.empty()) {
-        return toc;
+    // The closer for the opener at `open`, or npos when it isn't closed
+    // before `limit`
+    size_t matching(size_t open, size_t limit) const {
+        auto it = std::lower_bound(pairs_.begin(), pairs_.end(), open,
+                                   [](const Pair& pair, size_t pos) { return pair.open < pos; });
+        if (it == pairs_.end() || it->open != open || it->close >= limit) {
+            return npos;
+        }
+        return it->close;
+    }
+
+private:
+    struct Pair {
+        size_t open;
+        size_t close;
+    };
+    std::vector<Pair> pairs_;  // by opening position
+};
+
+// Where each run of backticks starts, by run length, so a code span's
+// closing run is a lookup rather than a scan
+class BacktickRuns {
+public:
+    explicit BacktickRuns(std::string_view text) {
+        for (size_t pos = text.find('`'); pos != npos; pos = text.find('`', pos)) {
+            size_t run = run_length(text, pos);
+            starts_[run].push_back(pos);
+            pos += run;
+        }
     }
     
-    // Simple regex-based extraction for headings
-    std::regex heading_regex(R"(^(#{1,6})\s+(.+)$)", std::regex::multiline);
-    auto begin = std::sregex_iterator(markdown.begin(), markdown.end(), heading_regex);
-    auto end = std::sregex_iterator();
+    // The first run of exactly `run` backticks at or after `from` that ends
+    // by `limit`
+    size_t next(size_t run, size_t from, size_t limit) const {
+        auto starts = starts_.find(run);
+        if (starts == starts_.end()) {
+            return npos;
+        }
+        auto it = std::lower_bound(starts->second.begin(), starts->second.end(), from);
+        return it != starts->second.end() && *it + run <= limit ? *it : npos;
+    }
+
+private:
+    std::map<size_t, std::vector<size_t>> starts_;
+};
+
+// The next occurrence of a string. Stripping only moves forward, so a
+// search resumes from the last one's answer instead of starting over.
+class ForwardFind {
+public:
+    ForwardFind(std::string_view text, std::string_view needle) : text_(text), needle_(needle) {}
     
-    for (auto it = begin; it != end; ++it) {
-        std::smatch match = *it;
-        TOCItem item;
-        item.level = match[1].length();  // Number of # characters
-        item.title = match[2].str();
-        item.offset = match.position();
-        
-        // Strip markdown formatting from title
-        item.title = stripMarkdownFormatting(item.title);
-        
-        toc.items.push_back(item);
+    // The first occurrence at or after `from` that ends by `limit`
+    size_t next(size_t from, size_t limit) {
+        if (from < searched_ || (found_ != npos && from > found_)) {
+            searched_ = from;
+            found_ = text_.find(needle_, from);
+        }
+        return found_ != npos && found_ + needle_.size() <= limit ? found_ : npos;
     }
+
+private:
+    std::string_view text_;
+    std::string_view needle_;
+    size_t searched_ = npos;
+    size_t found_ = npos;
+};
+
+// Appends `text` without its inline markup. A link's label is stripped
+// before going on after the link; labels nest, so where to go on is kept
+// on a stack rather than in recursive calls. Every lookup is either a table
+// built up front or a search that picks up where the last one stopped, so
+// the whole pass is linear in the text, however it's crafted.
+void strip_into(std::string_view text, std::string& out) {
+    Brackets brackets(text);
+    BacktickRuns backticks(text);
+    ForwardFind wikilink_close(text, "]]");
+    ForwardFind tag_close(text, ">");
+    ForwardFind scheme(text, "://");
+    ForwardFind at_sign(text, "@");
+    ForwardFind space(text, " ");
     
-    return toc;
+    struct Span {
+        size_t begin;
+        size_t end;
+        size_t resume;  // where the enclosing span goes on afterwards
+    };
+    std::vector<Span> enclosing;
+    size_t begin = 0;
+    size_t end = text.size();
+    size_t pos = 0;
+    for (;;) {
+        if (pos >= end) {
+            if (enclosing.empty()) {
+                break;
+            }
+            pos = enclosing.back().resume;
+            begin = enclosing.back().begin;
+            end = enclosing.back().end;
+            enclosing.pop_back();
+            continue;
+        }
+        std::string_view span = text.substr(0, end);
+        
+        char c = span[pos];
+        switch (c) {
+            case '\\':
+                if (pos + 1 < span.size() && std::ispunct(static_cast<unsigned char>(span[pos + 1]))) {
+                    out += span[pos + 1];
+                    pos += 2;
+                    continue;
+                }
+                break;
+            case '`': {
+                // A code span closes at the next run of the same length; its
+                // content is kept as is
+                size_t run = run_length(span, pos);
+                size_t close = backticks.next(run, pos + run, span.size());
+                if (close == npos) {
+                    out.append(span, pos, run);
+                    pos += run;
+                    continue;
+                }
+                std::string_view code = span.substr(pos + run, close - pos - run);
+                if (code.size() >= 2 && code.front() == ' ' && code.back() == ' ' && !trim(code).empty()) {
+                    code = code.substr(1, code.size() - 2);
+                }
+                out += code;
+                pos = close + run;
+                continue;
+            }
+            case '*':
+                pos += run_length(span, pos);
+                continue;
+            case '_': {
+                // Intraword underscores (snake_case) are not emphasis
+                size_t run = run_length(span, pos);
+                bool inside_word = pos > begin && pos + run < span.size() && is_word_char(span[pos - 1]) &&
+                                   is_word_char(span[pos + run]);
+                if (inside_word) {
+                    out.append(span, pos, run);
+                }
+                pos += run;
+                continue;
+            }
+            case '~': {
+                size_t run = run_length(span, pos);
+                if (run != 2) {
+                    out.append(span, pos, run);
+                }
+                pos += run;
+                continue;
+            }
+            case '!': {
+                // An image shows its alt text, like a link its label
+                size_t close = pos + 2 < span.size() && span[pos + 1] == '[' && span[pos + 2] != '['
+                                   ? brackets.matching(pos + 1, span.size())
+                                   : npos;
+                if (close != npos && close + 1 < span.size() && span[close + 1] == '(') {
+                    ++pos;
+                    continue;
+                }
+                break;
+            }
+            case '[': {
+                if (pos + 1 < span.size() && span[pos + 1] == '[') {
+                    // [[target|alias]] shows the alias, or the target
+                    size_t close = wikilink_close.next(pos + 2, span.size());
+                    if (close != npos) {
+                        std::string_view inner = span.substr(pos + 2, close - pos - 2);
+                        size_t pipe = inner.find('|');
+                        out += trim(pipe == npos ? inner : inner.substr(pipe + 1));
+                        pos = close + 2;
+                        continue;
+                    }
+                    break;
+                }
+                // [label](url) and [label][ref] show the label
+                size_t close = brackets.matching(pos, span.size());
+                if (close != npos && close + 1 < span.size() && (span[close + 1] == '(' || span[close + 1] == '[')) {
+                    size_t link_end = brackets.matching(close + 1, span.size());
+                    if (link_end != npos) {
+                        enclosing.push_back({begin, end, link_end + 1});
+                        begin = pos + 1;
+                        end = close;
+                        pos = begin;
+                        continue;
+                    }
+                }
+                break;
+            }
+            case '<': {
+                // Autolinks keep their address; HTML tags go
+                size_t close = tag_close.next(pos + 1, span.size());
+                if (close == npos) {
+                    break;
+                }
+                std::string_view inner = span.substr(pos + 1, close - pos - 1);
+                bool email = at_sign.next(pos + 1, close) != npos && space.next(pos + 1, close) == npos;
+                if (scheme.next(pos + 1, close) != npos || email) {
+                    out += inner;
+                    pos = close + 1;
+                    continue;
+                }
+                size_t name = !inner.empty() && inner.front() == '/' ? 1 : 0;
+                if (name < inner.size() && std::isalpha(static_cast<unsigned char>(inner[name]))) {
+                    pos = close + 1;
+                    continue;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        out += c;
+        ++pos;
+    }
 }
 
-std::string TOCGenerator::stripMarkdownFormatting(const std::string& text) {
-    std::string result = text;
-    
-    // Remove bold markers
-    result = std::regex_replace(result, std::regex(R"(\*\*|__)"), "");
-    
-    // Remove italic markers
-    result = std::regex_replace(result, std::regex(R"(\*|_)"), "");
+} // namespace
+
+std::string TOCGenerator::strip_inline_markup(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    strip_into(text, out);
+    return std::string(trim(out));
+}
+
+TOCGenerator::TOC TOCGenerator::generate(std::string_view markdown) {
+    TOC toc;
+    // Headings that can still take subheadings, innermost last
+    std::vector<size_t> open;
+    auto add = [&](int level, size_t offset, std::string_view raw_title) {
+        std::string title = strip_inline_markup(raw_title);
+        if (title.empty()) {
+            return;
+        }
+        while (!open.empty() && toc.items[open.back()].level >= level) {
+            open.pop_back();
+        }
+        size_t index = toc.items.size();
+        TOCItem item;
+        item.title = std::move(title);
+        item.level = level;
+        item.offset = offset;
+        if (open.empty()) {
+            toc.roots.push_back(index);
+        } else {
+            item.parent = open.back();
+            toc.items[open.back()].children.push_back(index);
+        }
+        toc.items.push_back(std::move(item));
+        open.push_back(index);
+    };
     
-    // Remove inline code markers
-    result = std::regex_replace(result, std::regex("`"), "");
+    char fence_char = 0;
+    size_t fence_length = 0;
+    // First line of the paragraph a setext underline would turn into a
+    // heading; npos when there's none, or it started in a list item
+    size_t paragraph = npos;
+    bool in_paragraph = false;
+    std::string setext_title;
     
-    // Remove links but keep link text
-    result = std::regex_replace(result, std::regex(R"(\[([^\]]+)\]\([^\)]+\))"), "$1");
+    size_t next = 0;
+    for (size_t line = 0; line < markdown.size(); line = next) {
+        size_t end = BlockScanner::line_end(markdown, line);
+        next = end + 1;
+        
+        if (fence_char) {
+            if (BlockScanner::is_closing_fence(markdown, line, fence_char, fence_length)) {
+                fence_char = 0;
+            }
+            continue;
+        }
+        
+        size_t indent;
+        size_t pos = content_start(markdown, line, end, indent);
+        if (trim(markdown.substr(pos, end - pos)).empty()) {
+            in_paragraph = false;
+            paragraph = npos;
+            continue;
+        }
+        if (indent >= 4) {
+            // Indented code, unless it continues a paragraph
+            continue;
+        }
+        
+        if (opens_fence(markdown, pos, end, fence_char, fence_length)) {
+            in_paragraph = false;
+            paragraph = npos;
+            continue;
+        }
+        if (int level = atx_level(markdown, pos, end)) {
+            add(level, line, atx_title(markdown.substr(pos + level, end - pos - level)));
+            in_paragraph = false;
+            paragraph = npos;
+            continue;
+        }
+        if (in_paragraph) {
+            if (int level = setext_level(markdown, pos, end); level && paragraph != npos) {
+                // The paragraph's lines, joined, are the title
+                setext_title.clear();
+                for (size_t text_line = paragraph; text_line < line;) {
+                    size_t text_end = BlockScanner::line_end(markdown, text_line);
+                    size_t unused;
+                    size_t text_pos = content_start(markdown, text_line, text_end, unused);
+                    if (!setext_title.empty()) {
+                        setext_title += ' ';
+                    }
+                    setext_title += trim(markdown.substr(text_pos, text_end - text_pos));
+                    text_line = text_end + 1;
+                }
+                add(level, paragraph, setext_title);
+                in_paragraph = false;
+                paragraph = npos;
+                continue;
+            }
+            if (BlockScanner::skip_list_marker(markdown, pos) != pos && !is_thematic_break(markdown, pos, end)) {
+                // A list item interrupts the paragraph
+                paragraph = npos;
+                continue;
+            }
+            if (!is_thematic_break(markdown, pos, end)) {
+                continue;
+            }
+        }
+        if (is_thematic_break(markdown, pos, end)) {
+            in_paragraph = false;
+            paragraph = npos;
+            continue;
+        }
+        
+        // Anything else starts a paragraph; list items and HTML can't be
+        // underlined into headings
+        in_paragraph = true;
+        bool list_item = BlockScanner::skip_list_marker(markdown, pos) != pos;
+        paragraph = list_item || markdown[pos] == '<' ? npos : line;
+    }
     
-    return result;
+    return toc;
 }
 
-} // namespace mdviewer
\ No newline at end of file
+} // namespace mdviewer
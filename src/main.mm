@@ -6,6 +6,12 @@
 #import <mach/mach.h>
 #import <mach/mach_host.h>
 #include "core/markdown_parser.h"
+#include "core/document_cache.h"
+#include "core/frontmatter.h"
+#include "core/mapped_file.h"
+#include "core/toc_diff.h"
+#include "core/latest_request.h"
+#include "utils/string_utils.h"
 #include "rendering/markdown_renderer.h"
 #include "platform/file_watcher.h"
 #import "ui/command_palette.h"
@@ -45,6 +51,8 @@ extern "C" void showSettingsWindow();
 @property (assign, nonatomic) NSInteger level;
 @property (retain, nonatomic) NSMutableArray<TOCItem*>* children;
 @property (assign, nonatomic) NSRange range;
+@property (assign, nonatomic) NSUInteger sourceOffset;
+@property (assign, nonatomic) TOCItem* parent;  // nil at the top level
 @end
 
 @implementation TOCItem
@@ -55,6 +63,8 @@ extern "C" void showSettingsWindow();
         _title = nil;
         _level = 0;
         _range = NSMakeRange(0, 0);
+        _sourceOffset = NSNotFound;
+        _parent = nil;
     }
     return self;
 }
@@ -249,6 +259,8 @@ extern "C" void showSettingsWindow();
 - (void)openFile:(NSString*)path;
 - (void)openFolder:(NSString*)folderPath;
 - (void)scrollToHeading:(TOCItem*)tocItem;
+- (BOOL)scrollToAnchor:(NSString*)fragment;
+- (NSUInteger)textIndexForSourceOffset:(NSUInteger)offset;
 - (void)updateAppearance;
 - (void)buildTOCFromDocument;
 - (void)buildFileTreeFromFolder:(NSString*)folderPath;
@@ -1055,6 +1067,10 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     NSOutlineView* _tocOutlineView;
     NSScrollView* _tocScrollView;
     NSMutableArray* _tocItems;
+    // What the outline shows: the table of contents it was built from and
+    // its items in the same pre-order, so a reload can be diffed against it
+    mdviewer::Document::TableOfContents _shownTOC;
+    NSMutableArray* _tocFlatItems;
     
     // File browser
     NSOutlineView* _fileOutlineView;
@@ -1081,7 +1097,15 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     std::unique_ptr<mdviewer::MarkdownParser> _parser;
     // std::unique_ptr<mdviewer::RenderEngine> _renderEngine;  // Commented out for now
     std::unique_ptr<mdviewer::FileWatcher> _fileWatcher;
-    std::unique_ptr<mdviewer::Document> _currentDocument;
+    // Reloads triggered by the file watcher; a newer save cancels the parse
+    // of the one before. _reloadTicket is set while a reload runs.
+    std::unique_ptr<mdviewer::LatestRequest> _reloads;
+    uint64_t _reloadTicket;
+    // Versions are immutable once parsed, so anything still holding the
+    // previous one (a pending render, a sidebar diff) can keep reading it
+    std::shared_ptr<const mdviewer::Document> _currentDocument;
+    // Whether its source views a mapping of the file rather than a copy
+    BOOL _currentSourceMapped;
     
     // Navigation history
     NSMutableArray<NSString*>* _navigationHistory;
@@ -1113,8 +1137,10 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     self = [super init];
     if (self) {
         _parser = std::make_unique<mdviewer::MarkdownParser>();
+        _parser->set_parse_threads(0);  // Large files only; small ones still parse serially
         // _renderEngine = std::make_unique<mdviewer::RenderEngine>();  // Commented out for now
         _fileWatcher = std::make_unique<mdviewer::FileWatcher>();
+        _reloads = std::make_unique<mdviewer::LatestRequest>();
         
         // Initialize search arrays with retained instance
         _searchResults = [[NSMutableArray alloc] init];
@@ -1122,6 +1148,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         
         // Initialize TOC items
         _tocItems = [[NSMutableArray array] retain];
+        _tocFlatItems = [[NSMutableArray alloc] init];
         
         // Initialize navigation history
         _navigationHistory = [[NSMutableArray array] retain];
@@ -1165,6 +1192,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         _searchResults = nil;
     }
     [_tocItems release];
+    [_tocFlatItems release];
     [_tocScrollView release];
     [_tocOutlineView release];
     [_fileOutlineView release];
@@ -1568,9 +1596,14 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     // _renderEngine->initialize((__bridge void*)_device, (__bridge void*)_metalView.layer);
     
     // Setup file watcher
+    // Editors that autosave report changes in bursts; only the last one's
+    // reload runs to the end
     _fileWatcher->set_callback([self](const std::string& path) {
+        uint64_t ticket = _reloads->supersede();
         dispatch_async(dispatch_get_main_queue(), ^{
-            [self reloadFile:[NSString stringWithUTF8String:path.c_str()]];
+            if (_reloads->is_current(ticket)) {
+                [self reloadFile:[NSString stringWithUTF8String:path.c_str()] ticket:ticket];
+            }
         });
     });
     
@@ -1767,7 +1800,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
                     }
                 });
             }
-            
+        
         } @catch (NSException* exception) {
             NSLog(@"Error in applySyntaxHighlighting: %@", exception.description);
             // Fall back to plain text if highlighting fails
@@ -1788,7 +1821,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
 }
 
 - (void)openFile:(NSString*)path {
-    
+
     // Check if this is a different file than what's currently open
     BOOL isDifferentFile = (!_currentFilePath || ![_currentFilePath isEqualToString:path]);
     
@@ -1831,8 +1864,9 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     
     NSUInteger fileSize = [fileAttributes[NSFileSize] unsignedIntegerValue];
     
-    // Warn for files over 5MB
-    if (fileSize > 5 * 1024 * 1024) {
+    // Loading is a mapping now; what's left to warn about is laying out
+    // the rendered text of very large files
+    if (fileSize > 50 * 1024 * 1024) {
         NSAlert* alert = [[NSAlert alloc] init];
         [alert setMessageText:@"Large File Warning"];
         NSString* sizeStr = [self formatFileSize:fileSize];
@@ -1859,68 +1893,101 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     }
     [[NSUserDefaults standardUserDefaults] synchronize];
     
-    NSError* error = nil;
-    NSString* content = [NSString stringWithContentsOfFile:path
-                                                  encoding:NSUTF8StringEncoding
-                                                     error:&error];
-    
-    if (error) {
+    // The file is mapped rather than decoded to UTF-16 and copied back, and
+    // the mapping is shared by the Document, whose text nodes view it.
+    // Obsidian-style YAML frontmatter is split off as a view, so the parser
+    // sees the body without another copy. A reload reads the file into
+    // memory of its own instead: the version it is diffed against next time
+    // has to keep its bytes when an editor rewrites the file in place.
+    std::error_code readError;
+    auto fileText = isDifferentFile
+        ? mdviewer::MappedFile::open([path fileSystemRepresentation], readError)
+        : mdviewer::MappedFile::read([path fileSystemRepresentation], readError);
+    if (!fileText) {
         NSAlert* alert = [[NSAlert alloc] init];
         [alert setMessageText:@"Error opening file"];
-        [alert setInformativeText:error.localizedDescription];
+        [alert setInformativeText:[NSString stringWithUTF8String:readError.message().c_str()]];
         [alert addButtonWithTitle:@"OK"];
         [alert runModal];
         return;
     }
     
-    // Make sure content is not nil
-    if (!content) {
-        content = @"";
-    }
-    
-    // Handle Obsidian-style YAML frontmatter
-    NSString* processedContent = content;
-    NSString* frontmatterContent = nil;
-    
-    // Check if content starts with "---\n"
-    if ([content hasPrefix:@"---\n"] || [content hasPrefix:@"---\r\n"]) {
-        // Find the closing --- delimiter
-        NSRange searchRange = NSMakeRange(3, [content length] - 3);
-        NSRange endDelimiter = [content rangeOfString:@"\n---\n" options:0 range:searchRange];
-        if (endDelimiter.location == NSNotFound) {
-            endDelimiter = [content rangeOfString:@"\r\n---\r\n" options:0 range:searchRange];
-        }
-        if (endDelimiter.location == NSNotFound) {
-            endDelimiter = [content rangeOfString:@"\n---\r\n" options:0 range:searchRange];
-        }
-        
-        if (endDelimiter.location != NSNotFound) {
-            // Extract frontmatter (including delimiters)
-            NSUInteger frontmatterEnd = endDelimiter.location + endDelimiter.length;
-            frontmatterContent = [content substringToIndex:frontmatterEnd];
-            
-            // Remove frontmatter from content for parsing
-            processedContent = [content substringFromIndex:frontmatterEnd];
-            
-            // Add a note about frontmatter being hidden (optional)
-            NSString* frontmatterNote = @"*[YAML frontmatter hidden - contains document metadata]*\n\n";
-            processedContent = [frontmatterNote stringByAppendingString:processedContent];
-            
-            NSLog(@"Detected YAML frontmatter (%lu characters)", (unsigned long)[frontmatterContent length]);
-        }
+    // Valid UTF-8, the usual case, is parsed straight from the mapping.
+    // UTF-16, and UTF-8 with stray Windows-1252 bytes pasted in, are decoded
+    // to UTF-8 first; a byte order mark is dropped either way.
+    std::string_view fileBytes = fileText->bytes();
+    std::shared_ptr<const void> textOwner = fileText;
+    size_t bomLength = 0;
+    auto encoding = mdviewer::StringUtils::detect_encoding(fileBytes, &bomLength);
+    fileBytes.remove_prefix(bomLength);
+    if (encoding != mdviewer::StringUtils::Encoding::UTF8 || !mdviewer::StringUtils::is_valid_utf8(fileBytes)) {
+        auto decoded = std::make_shared<std::string>();
+        mdviewer::StringUtils::to_utf8(fileBytes, encoding, *decoded, true);
+        fileBytes = *decoded;
+        textOwner = std::move(decoded);
+        NSLog(@"Decoded %@ to UTF-8", path);
+    }
+    BOOL sourceMapped = fileText->mapped() && textOwner == fileText;
+    auto frontmatter = mdviewer::Frontmatter::split(fileBytes);
+    std::string_view body = frontmatter.body();
+    if (frontmatter.present()) {
+        NSLog(@"Detected YAML frontmatter (%lu bytes)", (unsigned long)frontmatter.body_offset());
     }
     
     // We already have file attributes from earlier
     _currentFileSize = fileSize;
-    _currentLineCount = [[processedContent componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]] count];
     
     // Try to parse markdown with error handling
     NSDate* parseStart = [NSDate date];
     @try {
-        const char* markdownCStr = [processedContent UTF8String];
-        if (markdownCStr && strlen(markdownCStr) > 0) {
-            std::string markdown(markdownCStr);
-            _currentDocument = _parser->parse(markdown);
+        if (!body.empty()) {
+            // A reload that a newer save made stale stops early; that save's
+            // reload is already queued, so the previous version stays on
+            // screen until it runs
+            mdviewer::MarkdownParser::Limits limits;
+            if (_reloadTicket != 0) {
+                limits.token = _reloads->start(_reloadTicket);
+                if (!limits.token) {
+                    return;
+                }
+            }
+            
+            // On reload, only reparse the blocks around what changed on disk;
+            // the new version shares the rest with the previous one. A
+            // previous version that views a mapping may already show the new
+            // bytes, or fault, so it is parsed afresh instead.
+            std::shared_ptr<const mdviewer::Document> reparsed;
+            if (!isDifferentFile && !_currentSourceMapped && _currentDocument && _currentDocument->get_root()) {
+                auto edit = mdviewer::MarkdownParser::Edit::between(_currentDocument->source(), body);
+                auto status = mdviewer::MarkdownParser::ParseStatus::Complete;
+                reparsed = _parser->reparse_version(_currentDocument, edit, body, textOwner, limits, &status);
+                if (status != mdviewer::MarkdownParser::ParseStatus::Complete) {
+                    NSLog(@"Reload of %@ superseded by a newer save", path);
+                    return;
+                }
+            }
+            if (reparsed) {
+                _currentDocument = std::move(reparsed);
+            } else {
+                // Unchanged files reopen from the parse cache. Small files
+                // parse faster than an entry can be written, so only larger
+                // ones are stored.
+                std::filesystem::path cachePath([path fileSystemRepresentation]);
+                auto cached = mdviewer::DocumentCache::load(cachePath, body, textOwner, _parser->options_key());
+                if (cached) {
+                    _currentDocument = std::move(cached);
+                } else {
+                    auto result = _parser->parse(body, textOwner, limits);
+                    if (!result.complete()) {
+                        NSLog(@"Reload of %@ superseded by a newer save", path);
+                        return;
+                    }
+                    _currentDocument = std::move(result.document);
+                    if (body.size() >= 256 * 1024) {
+                        mdviewer::DocumentCache::store(cachePath, *_currentDocument, _parser->options_key());
+                    }
+                }
+            }
         } else {
             // Create empty document for empty files
             _currentDocument = std::make_unique<mdviewer::Document>();
@@ -1934,6 +2001,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         // Fall back to empty document
         _currentDocument = std::make_unique<mdviewer::Document>();
     }
+    _currentSourceMapped = sourceMapped;
     _lastParseTime = -[parseStart timeIntervalSinceNow] * 1000; // Convert to milliseconds
     
     // If document is still null, create an empty one
@@ -1941,6 +2009,9 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         _currentDocument = std::make_unique<mdviewer::Document>();
     }
     
+    // Counted once per parse; the status bar reads the same totals
+    _currentLineCount = _currentDocument->stats().lines;
+    
     // Check if dark mode is enabled
     // Use settings manager to determine theme
     auto& settings = mdviewer::ui::SettingsManager::getInstance();
@@ -1953,11 +2024,26 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         renderedContent = mdviewer::renderMarkdownDocument(_currentDocument.get(), isDarkMode);
     }
     
+    // Frontmatter isn't part of the parsed body; note above it that it was hidden
+    if (renderedContent && [renderedContent length] > 0 && frontmatter.present()) {
+        NSFont* noteFont = [[NSFontManager sharedFontManager] convertFont:[NSFont systemFontOfSize:[NSFont systemFontSize]]
+                                                              toHaveTrait:NSItalicFontMask];
+        NSDictionary* noteAttributes = @{NSFontAttributeName: noteFont,
+                                         NSForegroundColorAttributeName: [NSColor secondaryLabelColor]};
+        NSMutableAttributedString* withNote = [[[NSMutableAttributedString alloc]
+            initWithString:@"[YAML frontmatter hidden - contains document metadata]\n\n" attributes:noteAttributes] autorelease];
+        [withNote appendAttributedString:renderedContent];
+        renderedContent = withNote;
+    }
+    
     if (renderedContent && [renderedContent length] > 0) {
         [[_textView textStorage] setAttributedString:renderedContent];
     } else {
         // Fallback to raw content with syntax highlighting if rendering fails
-        [_textView setString:content];
+        NSString* content = [[[NSString alloc] initWithBytes:fileBytes.data()
+                                                      length:fileBytes.size()
+                                                    encoding:NSUTF8StringEncoding] autorelease];
+        [_textView setString:content ?: @""];
         [self applySyntaxHighlighting];
     }
     _lastRenderTime = -[renderStart timeIntervalSinceNow] * 1000; // Convert to milliseconds
@@ -2001,8 +2087,10 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     // [_metalView setNeedsDisplay:YES];
 }
 
-- (void)reloadFile:(NSString*)path {
+- (void)reloadFile:(NSString*)path ticket:(uint64_t)ticket {
+    _reloadTicket = ticket;
     [self openFile:path];
+    _reloadTicket = 0;
     
     // Update status bar after reload
     [self updateStatusBar];
@@ -2666,7 +2754,7 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         NSLog(@"Attempting to show command palette...");
         [_commandPalette show];
         NSLog(@"Command palette show method completed");
-        
+    
     } @catch (NSException *exception) {
         NSLog(@"EXCEPTION in showCommandPalette: %@", exception);
         NSLog(@"Stack trace: %@", [exception callStackSymbols]);
@@ -2777,6 +2865,29 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
             return YES; // We handled this link
         }
         
+        // Heading links: "#anchor" in this document, "note.md#anchor" in
+        // one next to it
+        NSString* fragment = [url fragment];
+        if (fragment && (![url scheme] || [url isFileURL])) {
+            NSString* path = [url path];
+            if (path.length > 0 && ![url isFileURL]) {
+                path = [[[_currentFilePath stringByDeletingLastPathComponent]
+                    stringByAppendingPathComponent:path] stringByStandardizingPath];
+            }
+            if (path.length == 0 || [path isEqualToString:_currentFilePath]) {
+                [self scrollToAnchor:fragment];
+                return YES;
+            }
+            if ([[NSFileManager defaultManager] fileExistsAtPath:path]) {
+                [self openFile:path];
+                // After openFile has scrolled the new file to the top
+                dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.2 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                    [self scrollToAnchor:fragment];
+                });
+                return YES;
+            }
+        }
+        
         // For regular URLs, open them
         [[NSWorkspace sharedWorkspace] openURL:url];
         return YES; // We handled the link
@@ -2954,50 +3065,148 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
 
 // MARK: - TOC Implementation
 
+- (NSString*)tocTitleForEntry:(const mdviewer::Document::TableOfContents::Entry&)entry {
+    return [[[NSString alloc] initWithBytes:entry.text.data()
+                                     length:entry.text.size()
+                                   encoding:NSUTF8StringEncoding] autorelease] ?: @"";
+}
+
+- (TOCItem*)tocItemForEntry:(const mdviewer::Document::TableOfContents::Entry&)entry {
+    TOCItem* item = [[[TOCItem alloc] init] autorelease];
+    item.level = entry.level;
+    item.sourceOffset = entry.position;
+    item.title = [self tocTitleForEntry:entry];
+    return item;
+}
+
 - (void)buildTOCFromDocument {
     if (!_currentDocument || !_currentDocument->get_root()) {
+        _shownTOC = mdviewer::Document::TableOfContents();
+        [_tocFlatItems removeAllObjects];
         [_tocItems release];
         _tocItems = [[NSMutableArray array] retain];
         [_tocOutlineView reloadData];
         return;
     }
     
+    const auto& toc = _currentDocument->get_toc();
+    auto entries = mdviewer::TOCDiff::flatten(toc);
+    
+    // A file-watcher reload usually touches a heading or two: update only
+    // those rows, which also keeps what the reader collapsed. The first
+    // outline, or one that changed wholesale, is built from scratch.
+    if (!_shownTOC.entries.empty()) {
+        auto script = mdviewer::TOCDiff::compute(_shownTOC, toc);
+        if (script.changes.size() <= entries.size() / 2) {
+            [self applyTOCScript:script entries:entries];
+            _shownTOC = toc;
+            return;
+        }
+    }
+    
     [_tocItems release];
     _tocItems = [[NSMutableArray array] retain];
+    [_tocFlatItems removeAllObjects];
+    for (const auto& entry : entries) {
+        TOCItem* item = [self tocItemForEntry:*entry.entry];
+        TOCItem* parent = entry.parent == mdviewer::TOCDiff::npos ? nil : _tocFlatItems[entry.parent];
+        item.parent = parent;
+        [(parent ? parent.children : _tocItems) addObject:item];
+        [_tocFlatItems addObject:item];
+    }
+    _shownTOC = toc;
     
-    // Traverse the document and find all headings
-    std::function<void(const mdviewer::Document::Node*, NSMutableArray*)> findHeadings = 
-        [&findHeadings](const mdviewer::Document::Node* node, NSMutableArray* items) {
-            if (node->type == mdviewer::Document::NodeType::Heading) {
-                TOCItem* item = [[[TOCItem alloc] init] autorelease];
-                item.level = node->heading_level;
-                
-                // Build title from text children
-                NSMutableString* title = [NSMutableString string];
-                for (const auto& child : node->children) {
-                    if (child->type == mdviewer::Document::NodeType::Text) {
-                        [title appendString:[NSString stringWithUTF8String:child->content.c_str()]];
-                    }
-                }
-                
-                item.title = title;
-                
-                // For now, just add all items at the top level
-                // We can implement hierarchy later
-                [items addObject:item];
-            }
-            
-            // Recursively process children
-            for (const auto& child : node->children) {
-                findHeadings(child.get(), items);
+    [_tocOutlineView reloadData];
+    [_tocOutlineView expandItem:nil expandChildren:YES];
+}
+
+// Brings the outline from _shownTOC to the table `entries` was flattened
+// from, with row updates for what `script` says changed
+- (void)applyTOCScript:(const mdviewer::TOCDiff::Script&)script
+               entries:(const std::vector<mdviewer::TOCDiff::Flat>&)entries {
+    using Kind = mdviewer::TOCDiff::Change::Kind;
+    constexpr size_t npos = mdviewer::TOCDiff::npos;
+    NSArray* oldItems = [[_tocFlatItems copy] autorelease];
+    auto oldEntries = mdviewer::TOCDiff::flatten(_shownTOC);
+    
+    // Items under a removed one leave the outline with it; those the new
+    // outline keeps are put back below, as if inserted
+    std::vector<bool> removed(oldEntries.size(), false);
+    std::vector<bool> detached(oldEntries.size(), false);
+    for (const auto& change : script.changes) {
+        if (change.kind == Kind::Remove) {
+            removed[change.old_index] = true;
+        }
+    }
+    for (size_t index = 0; index < oldEntries.size(); ++index) {
+        size_t parent = oldEntries[index].parent;
+        detached[index] = !removed[index] && parent != npos && (removed[parent] || detached[parent]);
+    }
+    
+    [_tocOutlineView beginUpdates];
+    
+    // Removes come last to first, so sibling indexes ahead stay put
+    for (const auto& change : script.changes) {
+        size_t parent = change.kind == Kind::Remove ? oldEntries[change.old_index].parent : npos;
+        if (change.kind != Kind::Remove || (parent != npos && removed[parent])) {
+            continue;
+        }
+        TOCItem* item = oldItems[change.old_index];
+        NSMutableArray* siblings = item.parent ? item.parent.children : _tocItems;
+        NSUInteger index = [siblings indexOfObjectIdenticalTo:item];
+        [siblings removeObjectAtIndex:index];
+        [_tocOutlineView removeItemsAtIndexes:[NSIndexSet indexSetWithIndex:index]
+                                     inParent:item.parent
+                                withAnimation:NSTableViewAnimationEffectNone];
+    }
+    
+    // Then every entry in order is put in its place; the ones before it
+    // under the same parent already are, so an item that's there stays
+    NSMutableArray* items = [NSMutableArray arrayWithCapacity:entries.size()];
+    NSMutableArray* insertedItems = [NSMutableArray array];
+    for (size_t index = 0; index < entries.size(); ++index) {
+        const auto& entry = entries[index];
+        TOCItem* parent = entry.parent == npos ? nil : items[entry.parent];
+        NSMutableArray* siblings = parent ? parent.children : _tocItems;
+        size_t oldIndex = script.matches[index];
+        TOCItem* item;
+        if (oldIndex == npos || detached[oldIndex]) {
+            item = oldIndex == npos ? [self tocItemForEntry:*entry.entry] : oldItems[oldIndex];
+            [item.children removeAllObjects];
+            [siblings insertObject:item atIndex:entry.sibling];
+            [_tocOutlineView insertItemsAtIndexes:[NSIndexSet indexSetWithIndex:entry.sibling]
+                                         inParent:parent
+                                    withAnimation:NSTableViewAnimationEffectNone];
+            [insertedItems addObject:item];
+        } else {
+            item = oldItems[oldIndex];
+            NSMutableArray* current = item.parent ? item.parent.children : _tocItems;
+            NSUInteger from = [current indexOfObjectIdenticalTo:item];
+            if (item.parent != parent || from != entry.sibling) {
+                [current removeObjectAtIndex:from];
+                [siblings insertObject:item atIndex:entry.sibling];
+                [_tocOutlineView moveItemAtIndex:from inParent:item.parent toIndex:entry.sibling inParent:parent];
             }
-        };
+        }
+        item.parent = parent;
+        item.sourceOffset = entry.entry->position;
+        [items addObject:item];
+    }
     
-    const mdviewer::Document::Node* root = _currentDocument->get_root();
-    findHeadings(root, _tocItems);
+    for (const auto& change : script.changes) {
+        if (change.kind == Kind::Retitle) {
+            TOCItem* item = items[change.new_index];
+            item.title = [self tocTitleForEntry:*entries[change.new_index].entry];
+            [_tocOutlineView reloadItem:item];
+        }
+    }
     
-    [_tocOutlineView reloadData];
-    [_tocOutlineView expandItem:nil expandChildren:YES];
+    [_tocOutlineView endUpdates];
+    
+    for (TOCItem* item in insertedItems) {
+        [_tocOutlineView expandItem:item];
+    }
+    [_tocFlatItems setArray:items];
 }
 
 - (void)toggleTOCSidebar {
@@ -3418,11 +3627,23 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     NSString* headingText = tocItem.title;
     NSString* textViewContent = [_textView string];
     
-    // Find the heading in the text view
-    NSRange searchRange = NSMakeRange(0, [textViewContent length]);
-    NSRange foundRange = [textViewContent rangeOfString:headingText 
-                                                options:NSCaseInsensitiveSearch 
-                                                  range:searchRange];
+    // Locate the heading by its source position, which stays right when
+    // the same title appears more than once
+    NSRange foundRange = NSMakeRange(NSNotFound, 0);
+    if (tocItem.sourceOffset != NSNotFound) {
+        NSUInteger location = [self textIndexForSourceOffset:tocItem.sourceOffset];
+        if (location != NSNotFound) {
+            foundRange = NSMakeRange(location, MIN([headingText length], [textViewContent length] - location));
+        }
+    }
+    
+    // Fall back to finding the heading text in the text view
+    if (foundRange.location == NSNotFound) {
+        NSRange searchRange = NSMakeRange(0, [textViewContent length]);
+        foundRange = [textViewContent rangeOfString:headingText 
+                                            options:NSCaseInsensitiveSearch 
+                                              range:searchRange];
+    }
     
     if (foundRange.location != NSNotFound) {
         // Scroll to the heading
@@ -3436,6 +3657,67 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     }
 }
 
+// Scrolls to the heading a link fragment names, found in the document's
+// anchor index
+- (BOOL)scrollToAnchor:(NSString*)fragment {
+    if (!_currentDocument || !fragment) {
+        return NO;
+    }
+    const auto* anchor = _currentDocument->find_anchor([fragment UTF8String]);
+    if (!anchor) {
+        return NO;
+    }
+    NSUInteger location = [self textIndexForSourceOffset:anchor->position];
+    if (location == NSNotFound) {
+        return NO;
+    }
+    
+    NSRange headingRange = [[_textView string] lineRangeForRange:NSMakeRange(location, 0)];
+    [_textView scrollRangeToVisible:headingRange];
+    [_textView setSelectedRange:headingRange];
+    [_textView showFindIndicatorForRange:headingRange];
+    return YES;
+}
+
+// Rendered text keeps source order, so the first character rendered from
+// at or after `offset` can be found by bisecting on its SourceOffset
+// attribute. Runs without one (separators, list bullets) are skipped.
+- (NSUInteger)textIndexForSourceOffset:(NSUInteger)offset {
+    NSTextStorage* storage = [_textView textStorage];
+    NSUInteger low = 0;
+    NSUInteger high = [storage length];
+    
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        NSUInteger probe = mid;
+        NSNumber* value = nil;
+        NSRange run = NSMakeRange(mid, 0);
+        while (probe < high) {
+            value = [storage attribute:mdviewer::SourceOffsetAttributeName atIndex:probe effectiveRange:&run];
+            if (value) break;
+            probe = NSMaxRange(run);
+        }
+        
+        if (!value) {
+            high = mid;
+        } else if ([value unsignedIntegerValue] < offset) {
+            low = NSMaxRange(run);
+        } else {
+            high = MAX(run.location, low);
+        }
+    }
+    
+    // low may sit on an unattributed run just before the match
+    while (low < [storage length]) {
+        NSRange run;
+        if ([storage attribute:mdviewer::SourceOffsetAttributeName atIndex:low effectiveRange:&run]) {
+            return low;
+        }
+        low = NSMaxRange(run);
+    }
+    return NSNotFound;
+}
+
 - (void)tocItemClicked:(id)sender {
     NSInteger clickedRow = [_tocOutlineView clickedRow];
     NSLog(@"TOC clicked, row: %ld", (long)clickedRow);
@@ -4401,26 +4683,12 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
     // We'll use 225 WPM as a balanced estimate
     const NSInteger wordsPerMinute = 225;
     
-    // Get the text content (without markdown syntax would be better, but this is good enough)
-    NSString* text = [_textView string];
-    if (!text || text.length == 0) {
+    // Words of the parsed text, markdown syntax excluded
+    if (!_currentDocument || _currentDocument->stats().words == 0) {
         return @"📖 0 min read";
     }
-    
-    // Count words - split by whitespace and newlines
-    NSCharacterSet* separators = [NSCharacterSet whitespaceAndNewlineCharacterSet];
-    NSArray* words = [text componentsSeparatedByCharactersInSet:separators];
-    
-    // Filter out empty strings
-    NSInteger wordCount = 0;
-    for (NSString* word in words) {
-        if (word.length > 0) {
-            wordCount++;
-        }
-    }
-    
-    // Calculate reading time in minutes
-    NSInteger minutes = (wordCount + wordsPerMinute - 1) / wordsPerMinute; // Round up
+    const auto& stats = _currentDocument->stats();
+    NSInteger minutes = (NSInteger)stats.reading_minutes(wordsPerMinute);
     
     // Format the reading time string
     if (minutes == 0) {
@@ -4455,19 +4723,15 @@ typedef NS_ENUM(NSInteger, FileSortMode) {
         }
     }
     
-    // Calculate reading time (250 words per minute average)
+    // Calculate reading time (250 words per minute average) from the
+    // statistics counted when the document was parsed
     NSUInteger wordCount = 0;
-    if (_textView) {
-        NSString* text = [[_textView textStorage] string];
-        if (text) {
-            // Simple word count - split by whitespace and newlines
-            NSArray* words = [text componentsSeparatedByCharactersInSet:
-                            [NSCharacterSet whitespaceAndNewlineCharacterSet]];
-            wordCount = [[words filteredArrayUsingPredicate:
-                        [NSPredicate predicateWithFormat:@"length > 0"]] count];
-        }
+    NSUInteger readingMinutes = 1;
+    if (_currentDocument) {
+        const auto& stats = _currentDocument->stats();
+        wordCount = stats.words;
+        readingMinutes = MAX((size_t)1, stats.reading_minutes(250));
     }
-    NSUInteger readingMinutes = MAX(1, (wordCount + 249) / 250); // Round up
     NSString* readingTime = readingMinutes == 1 ? @"~1 min read" : 
                            [NSString stringWithFormat:@"~%lu min read", (unsigned long)readingMinutes];
     
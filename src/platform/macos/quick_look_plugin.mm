@@ -5,12 +5,14 @@
 #import <WebKit/WebKit.h>
 #include <objc/runtime.h>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <memory>
 
 // Include the actual header if dependencies are available
 #ifdef HAVE_MD4C
 #include "core/markdown_parser.h"
+#include "utils/string_utils.h"
 #else
 // Mock classes for compilation when dependencies are not available
 namespace mdviewer {
@@ -377,8 +379,11 @@ namespace mdviewer {
     html << "</li>\n";
 }
 
-- (std::string)escapeHTML:(const std::string&)text {
+- (std::string)escapeHTML:(std::string_view)text {
     std::string escaped;
+#ifdef HAVE_MD4C
+    mdviewer::StringUtils::escape_html(text, escaped);
+#else
     escaped.reserve(text.size());
     
     for (char c : text) {
@@ -391,6 +396,7 @@ namespace mdviewer {
             default: escaped += c; break;
         }
     }
+#endif
     
     return escaped;
 }
@@ -3,7 +3,10 @@
 #import "mermaid_renderer.h"
 #include "core/document.h"
 #include "core/markdown_parser.h"
+#include "rendering/markdown_renderer.h"
+#include <algorithm>
 #include <stack>
+#include <vector>
 
 // Custom text attachment for inline Mermaid diagrams
 @interface MermaidTextAttachment : NSTextAttachment
@@ -261,6 +264,16 @@
 
 @implementation MarkdownRenderer
 
+// Deeper lists render at this indentation rather than off the page
+static const NSInteger kMaxListIndentLevel = 12;
+
+// Node text is a view into the document's source, not a C string
++ (NSString*)stringFromText:(std::string_view)text {
+    return [[[NSString alloc] initWithBytes:text.data()
+                                     length:text.size()
+                                   encoding:NSUTF8StringEncoding] autorelease];
+}
+
 + (NSDictionary*)baseAttributesForDarkMode:(BOOL)isDarkMode {
     // Premium typography with elegant serif font for body text
     NSColor* textColor = isDarkMode ? 
@@ -426,6 +439,10 @@
     };
 }
 
+// Renders `node` and everything under it. Lists and quotes can nest
+// arbitrarily deep in generated input, so the tree is walked with an
+// explicit stack rather than a call per level, and list indentation stops
+// growing past kMaxListIndentLevel.
 + (void)renderNode:(const mdviewer::Document::Node*)node 
           toString:(NSMutableAttributedString*)result 
         isDarkMode:(BOOL)isDarkMode 
@@ -434,6 +451,51 @@
     
     if (!node) return;
     
+    struct Pending {
+        const mdviewer::Document::Node* node;
+        NSMutableDictionary* attrs;
+        NSInteger indentLevel;
+        BOOL opened;
+    };
+    std::vector<Pending> pending{{node, currentAttrs, indentLevel, NO}};
+    while (!pending.empty()) {
+        Pending next = pending.back();
+        if (next.opened) {
+            pending.pop_back();
+            [self closeNode:next.node toString:result];
+            continue;
+        }
+        pending.back().opened = YES;
+        
+        BOOL renderChildren = [self openNode:next.node
+                                    toString:result
+                                  isDarkMode:isDarkMode
+                                currentAttrs:next.attrs
+                                 indentLevel:next.indentLevel];
+        if (!renderChildren) {
+            continue;
+        }
+        
+        NSInteger childIndent = next.indentLevel;
+        // Increase indent for list items
+        if (next.node->type == mdviewer::Document::NodeType::List) {
+            childIndent = std::min<NSInteger>(childIndent + 1, kMaxListIndentLevel);
+        }
+        for (auto it = next.node->children.rbegin(); it != next.node->children.rend(); ++it) {
+            NSMutableDictionary* childAttrs = [[next.attrs mutableCopy] autorelease];
+            pending.push_back({it->get(), childAttrs, childIndent, NO});
+        }
+    }
+}
+
+// Starts rendering `node`: its own content, and the attributes its
+// children inherit. NO when the children have been rendered already.
++ (BOOL)openNode:(const mdviewer::Document::Node*)node 
+        toString:(NSMutableAttributedString*)result 
+      isDarkMode:(BOOL)isDarkMode 
+    currentAttrs:(NSMutableDictionary*)currentAttrs
+     indentLevel:(NSInteger)indentLevel {
+    
     NSDictionary* nodeAttrs = nil;
     BOOL shouldRenderChildren = YES;
     
@@ -470,7 +532,7 @@
             // Collect all text from child nodes
             for (const auto& child : node->children) {
                 if (child->type == mdviewer::Document::NodeType::Text) {
-                    NSString* text = [NSString stringWithUTF8String:child->content.c_str()];
+                    NSString* text = [self stringFromText:child->content];
                     if (text) {
                         [codeContent appendString:text];
                     }
@@ -479,7 +541,7 @@
             
             // If no children, try direct content
             if ([codeContent length] == 0 && !node->content.empty()) {
-                NSString* directContent = [NSString stringWithUTF8String:node->content.c_str()];
+                NSString* directContent = [self stringFromText:node->content];
                 if (directContent) {
                     [codeContent appendString:directContent];
                 }
@@ -703,10 +765,12 @@
         
         case mdviewer::Document::NodeType::Text: {
             // Render text content
-            NSString* text = [NSString stringWithUTF8String:node->content.c_str()];
+            NSString* text = [self stringFromText:node->content];
             if (text) {
+                NSMutableDictionary* textAttrs = [[currentAttrs mutableCopy] autorelease];
+                textAttrs[mdviewer::SourceOffsetAttributeName] = @(node->source_start);
                 [result appendAttributedString:[[NSAttributedString alloc] 
-                    initWithString:text attributes:currentAttrs]];
+                    initWithString:text attributes:textAttrs]];
             }
             shouldRenderChildren = NO;
             break;
@@ -792,20 +856,11 @@
         [currentAttrs addEntriesFromDictionary:nodeAttrs];
     }
     
-    // Render children
-    if (shouldRenderChildren) {
-        NSInteger childIndent = indentLevel;
-        // Increase indent for list items
-        if (node->type == mdviewer::Document::NodeType::List) {
-            childIndent++;
-        }
-        
-        for (const auto& child : node->children) {
-            NSMutableDictionary* childAttrs = [currentAttrs mutableCopy];
-            [self renderNode:child.get() toString:result isDarkMode:isDarkMode currentAttrs:childAttrs indentLevel:childIndent];
-        }
-    }
-    
+    return shouldRenderChildren;
+}
+
+// Finishes rendering `node` once its children are done
++ (void)closeNode:(const mdviewer::Document::Node*)node toString:(NSMutableAttributedString*)result {
     // Add spacing after certain block elements
     if (node->type == mdviewer::Document::NodeType::Paragraph ||
         node->type == mdviewer::Document::NodeType::Heading ||
@@ -844,18 +899,9 @@
     NSLog(@"DEBUG: Root node has %zu children", root->children.size());
     
     // Debug: Count code blocks
-    int codeBlockCount = 0;
-    std::function<void(const mdviewer::Document::Node*)> countCodeBlocks = 
-        [&countCodeBlocks, &codeBlockCount](const mdviewer::Document::Node* node) {
-            if (node->type == mdviewer::Document::NodeType::CodeBlock) {
-                codeBlockCount++;
-            }
-            for (const auto& child : node->children) {
-                countCodeBlocks(child.get());
-            }
-        };
-    countCodeBlocks(root);
-    NSLog(@"DEBUG: Document contains %d code blocks", codeBlockCount);
+    NSLog(@"DEBUG: Document contains %zu code blocks (%zu mermaid)",
+          document->nodes_of_type(mdviewer::Document::NodeType::CodeBlock).size(),
+          document->code_blocks("mermaid").size());
     
     for (const auto& child : root->children) {
         NSMutableDictionary* attrs = [baseAttrs mutableCopy];
@@ -871,7 +917,9 @@
 
 // C++ wrapper for Objective-C renderer
 namespace mdviewer {
-    
+
+NSString* const SourceOffsetAttributeName = @"SourceOffset";
+
 NSAttributedString* renderMarkdownDocument(const Document* doc, bool isDarkMode) {
     return [MarkdownRenderer renderDocument:doc isDarkMode:isDarkMode];
 }
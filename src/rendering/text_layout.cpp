@@ -1,4 +1,5 @@
 #include "rendering/text_layout.h"
+#include "core/node_visitor.h"
 #include <CoreText/CoreText.h>
 #include <unordered_map>
 #include <algorithm>
@@ -56,20 +57,27 @@ std::vector<TextLayout::Paragraph> TextLayout::layout_document(const Document* d
     
     float y_offset = 0.0f;
     
-    doc->visit([this, &paragraphs, &y_offset](const Document::Node& node) {
-        if (node.type == Document::NodeType::Paragraph ||
-            node.type == Document::NodeType::Heading ||
-            node.type == Document::NodeType::CodeBlock) {
-            
-            Paragraph para = layout_node(&node, options_.max_width);
-            para.y = y_offset;
-            
-            y_offset += para.height + options_.paragraph_spacing * options_.font_size;
-            
-            apply_smart_typography(para);
-            paragraphs.push_back(std::move(para));
-        }
-    });
+    // Each block is laid out whole, so its inline children need no visit
+    auto layout_block = [this, &paragraphs, &y_offset](const Document::Node& node) {
+        Paragraph para = layout_node(&node, options_.max_width);
+        para.y = y_offset;
+        
+        y_offset += para.height + options_.paragraph_spacing * options_.font_size;
+        
+        apply_smart_typography(para);
+        paragraphs.push_back(std::move(para));
+        return Visit::SkipChildren;
+    };
+    auto visitor = Overloaded{
+        [&](const Document::Node& node, NodeTag<Document::NodeType::Paragraph>) { return layout_block(node); },
+        [&](const Document::Node& node, NodeTag<Document::NodeType::Heading>) { return layout_block(node); },
+        [&](const Document::Node& node, NodeTag<Document::NodeType::CodeBlock>) { return layout_block(node); },
+    };
+    // The parser's root is itself a Paragraph, so walking from it would lay
+    // out the whole document as one block; start at its children instead
+    for (const auto& block : doc->get_root()->children) {
+        walk(block.get(), visitor);
+    }
     
     return paragraphs;
 }
@@ -81,17 +89,11 @@ TextLayout::Paragraph TextLayout::layout_node(const Document::Node* node, float
     
     // Collect all text from the node
     std::string full_text;
-    std::function<void(const Document::Node*)> collect_text = 
-        [&full_text, &collect_text](const Document::Node* n) {
-        if (n->type == Document::NodeType::Text) {
-            full_text += n->content;
-        }
-        for (const auto& child : n->children) {
-            collect_text(child.get());
+    for (const Document::Node& n : preorder(node)) {
+        if (n.type == Document::NodeType::Text) {
+            full_text += n.content;
         }
-    };
-    
-    collect_text(node);
+    }
     
     // Create attributed string for Core Text
     CFStringRef cf_text = CFStringCreateWithCString(
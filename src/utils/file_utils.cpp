@@ -6,14 +6,28 @@
 namespace mdviewer {
 
 std::optional<std::string> FileUtils::read_file(const std::filesystem::path& path) {
-    std::ifstream file(path, std::ios::binary);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         return std::nullopt;
     }
     
-    std::ostringstream ss;
-    ss << file.rdbuf();
-    return ss.str();
+    // Read straight into a string of the file's size, rather than through a
+    // stream buffer and a second copy out of it. Files with no size up front
+    // (pipes) fall back to streaming.
+    std::streamoff size = file.tellg();
+    if (size <= 0) {
+        file.clear();
+        file.seekg(0);
+        std::ostringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+    
+    std::string content(static_cast<size_t>(size), '\0');
+    file.seekg(0);
+    file.read(content.data(), size);
+    content.resize(static_cast<size_t>(file.gcount()));
+    return content;
 }
 
 bool FileUtils::write_file(const std::filesystem::path& path, const std::string& content) {
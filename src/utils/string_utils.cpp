@@ -1,51 +1,149 @@
 #include "utils/string_utils.h"
+#include "../core/simd_block.h"
+#include "html_entities.h"
 #include <algorithm>
-#include <sstream>
-#include <cctype>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 
 namespace mdviewer {
 
+namespace {
+
+// std::isspace in the C locale
+bool is_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// Flips the case of the ASCII letters from `first` to `last`, 32 bytes per
+// step as four 64-bit words. In each word, adding to the low seven bits
+// of every byte sets its high bit when the byte clears a bound, without
+// carrying into the next byte.
+void flip_ascii_case(char* data, size_t size, char first, char last) {
+    constexpr uint64_t ones = 0x0101010101010101ULL;
+    constexpr uint64_t high = 0x8080808080808080ULL;
+    const uint64_t from_first = (0x80 - static_cast<uint64_t>(first)) * ones;
+    const uint64_t past_last = (0x7F - static_cast<uint64_t>(last)) * ones;
+    auto flip_word = [&](char* at) {
+        uint64_t word;
+        std::memcpy(&word, at, sizeof(word));
+        const uint64_t low = word & ~high;
+        const uint64_t letters = (low + from_first) & ~(low + past_last) & ~word & high;
+        word ^= letters >> 2;
+        std::memcpy(at, &word, sizeof(word));
+    };
+    size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        flip_word(data + pos);
+        flip_word(data + pos + 8);
+        flip_word(data + pos + 16);
+        flip_word(data + pos + 24);
+    }
+    for (; pos + 8 <= size; pos += 8) {
+        flip_word(data + pos);
+    }
+    for (; pos < size; ++pos) {
+        if (data[pos] >= first && data[pos] <= last) {
+            data[pos] ^= 0x20;
+        }
+    }
+}
+
+} // namespace
+
 std::string StringUtils::trim_left(const std::string& str) {
-    auto start = std::find_if_not(str.begin(), str.end(), [](unsigned char ch) {
-        return std::isspace(ch);
-    });
-    return std::string(start, str.end());
+    return std::string(trim_left_view(str));
 }
 
 std::string StringUtils::trim_right(const std::string& str) {
-    auto end = std::find_if_not(str.rbegin(), str.rend(), [](unsigned char ch) {
-        return std::isspace(ch);
-    }).base();
-    return std::string(str.begin(), end);
+    return std::string(trim_right_view(str));
 }
 
 std::string StringUtils::trim(const std::string& str) {
-    return trim_left(trim_right(str));
+    return std::string(trim_view(str));
+}
+
+std::string_view StringUtils::trim_left_view(std::string_view str) {
+    size_t start = 0;
+    while (start < str.size() && is_space(str[start])) {
+        ++start;
+    }
+    return str.substr(start);
+}
+
+std::string_view StringUtils::trim_right_view(std::string_view str) {
+    size_t end = str.size();
+    while (end > 0 && is_space(str[end - 1])) {
+        --end;
+    }
+    return str.substr(0, end);
+}
+
+std::string_view StringUtils::trim_view(std::string_view str) {
+    return trim_left_view(trim_right_view(str));
+}
+
+StringUtils::PieceRange::iterator& StringUtils::PieceRange::iterator::operator++() {
+    if (last_) {
+        done_ = true;
+        return *this;
+    }
+    const void* found = rest_.empty() ? nullptr : std::memchr(rest_.data(), delimiter_, rest_.size());
+    if (found) {
+        const size_t length = static_cast<const char*>(found) - rest_.data();
+        piece_ = rest_.substr(0, length);
+        rest_.remove_prefix(length + 1);
+        // A final newline ends the last line rather than starting one
+        last_ = lines_ && rest_.empty();
+    } else {
+        piece_ = rest_;
+        rest_ = {};
+        last_ = true;
+    }
+    if (lines_ && !piece_.empty() && piece_.back() == '\r') {
+        piece_.remove_suffix(1);
+    }
+    return *this;
+}
+
+StringUtils::PieceRange::iterator StringUtils::PieceRange::begin() const {
+    if (lines_ && str_.empty()) {
+        return end();
+    }
+    iterator first;
+    first.rest_ = str_;
+    first.delimiter_ = delimiter_;
+    first.lines_ = lines_;
+    first.done_ = false;
+    return ++first;
+}
+
+StringUtils::PieceRange StringUtils::split_range(std::string_view str, char delimiter) {
+    return PieceRange(str, delimiter, false);
+}
+
+StringUtils::PieceRange StringUtils::lines(std::string_view str) {
+    return PieceRange(str, '\n', true);
 }
 
 std::vector<std::string> StringUtils::split(const std::string& str, char delimiter) {
     std::vector<std::string> result;
-    std::stringstream ss(str);
-    std::string item;
-    
-    while (std::getline(ss, item, delimiter)) {
-        result.push_back(item);
+    for (std::string_view piece : split_range(str, delimiter)) {
+        result.emplace_back(piece);
+    }
+    // std::getline finds nothing after a final delimiter
+    if (result.back().empty()) {
+        result.pop_back();
     }
-    
     return result;
 }
 
 std::vector<std::string_view> StringUtils::split_view(std::string_view str, char delimiter) {
     std::vector<std::string_view> result;
-    size_t start = 0;
-    size_t end = 0;
-    
-    while (end != std::string_view::npos) {
-        end = str.find(delimiter, start);
-        result.push_back(str.substr(start, end - start));
-        start = end + 1;
+    for (std::string_view piece : split_range(str, delimiter)) {
+        result.push_back(piece);
     }
-    
     return result;
 }
 
@@ -54,9 +152,16 @@ std::string StringUtils::join(const std::vector<std::string>& parts, const std::
         return "";
     }
     
-    std::string result = parts[0];
+    size_t length = separator.size() * (parts.size() - 1);
+    for (const auto& part : parts) {
+        length += part.size();
+    }
+    std::string result;
+    result.reserve(length);
+    result += parts[0];
     for (size_t i = 1; i < parts.size(); ++i) {
-        result += separator + parts[i];
+        result += separator;
+        result += parts[i];
     }
     
     return result;
@@ -64,30 +169,58 @@ std::string StringUtils::join(const std::vector<std::string>& parts, const std::
 
 std::string StringUtils::to_lower(const std::string& str) {
     std::string result = str;
-    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) {
-        return std::tolower(c);
-    });
+    to_lower_in_place(result);
     return result;
 }
 
 std::string StringUtils::to_upper(const std::string& str) {
     std::string result = str;
-    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) {
-        return std::toupper(c);
-    });
+    to_upper_in_place(result);
     return result;
 }
 
+void StringUtils::to_lower_in_place(std::string& str) {
+    flip_ascii_case(str.data(), str.size(), 'A', 'Z');
+}
+
+void StringUtils::to_upper_in_place(std::string& str) {
+    flip_ascii_case(str.data(), str.size(), 'a', 'z');
+}
+
 std::string StringUtils::replace_all(const std::string& str, const std::string& from, const std::string& to) {
-    std::string result = str;
-    size_t pos = 0;
+    std::string result;
+    replace_all(str, from, to, result);
+    return result;
+}
+
+void StringUtils::replace_all(std::string_view str, std::string_view from, std::string_view to, std::string& out) {
+    if (from.empty()) {
+        out.append(str);
+        return;
+    }
     
-    while ((pos = result.find(from, pos)) != std::string::npos) {
-        result.replace(pos, from.length(), to);
-        pos += to.length();
+    // Counted first, so the output is sized once and written in one pass
+    size_t count = 0;
+    for (size_t pos = str.find(from); pos != std::string_view::npos; pos = str.find(from, pos + from.size())) {
+        ++count;
+    }
+    if (count == 0) {
+        out.append(str);
+        return;
     }
     
-    return result;
+    const size_t start = out.size();
+    out.resize(start + str.size() - count * from.size() + count * to.size());
+    char* dest = out.data() + start;
+    size_t copied = 0;
+    for (size_t pos = str.find(from); pos != std::string_view::npos; pos = str.find(from, pos + from.size())) {
+        std::memcpy(dest, str.data() + copied, pos - copied);
+        dest += pos - copied;
+        std::memcpy(dest, to.data(), to.size());
+        dest += to.size();
+        copied = pos + from.size();
+    }
+    std::memcpy(dest, str.data() + copied, str.size() - copied);
 }
 
 bool StringUtils::starts_with(std::string_view str, std::string_view prefix) {
@@ -106,32 +239,13 @@ bool StringUtils::contains(std::string_view str, std::string_view substring) {
 
 std::string StringUtils::escape_html(const std::string& str) {
     std::string result;
-    result.reserve(str.size() * 1.2); // Reserve some extra space
-    
-    for (char ch : str) {
-        switch (ch) {
-            case '<': result += "&lt;"; break;
-            case '>': result += "&gt;"; break;
-            case '&': result += "&amp;"; break;
-            case '"': result += "&quot;"; break;
-            case '\'': result += "&#39;"; break;
-            default: result += ch; break;
-        }
-    }
-    
+    escape_html(str, result);
     return result;
 }
 
 std::string StringUtils::unescape_html(const std::string& str) {
-    std::string result = str;
-    
-    // Simple implementation for basic HTML entities
-    result = replace_all(result, "&lt;", "<");
-    result = replace_all(result, "&gt;", ">");
-    result = replace_all(result, "&amp;", "&");
-    result = replace_all(result, "&quot;", "\"");
-    result = replace_all(result, "&#39;", "'");
-    
+    std::string result;
+    unescape_html(str, result);
     return result;
 }
 
@@ -156,18 +270,692 @@ size_t StringUtils::utf8_length(std::string_view str) {
 }
 
 std::string StringUtils::utf8_substr(std::string_view str, size_t start, size_t length) {
-    // Simplified implementation - for full UTF-8 support, would need more robust handling
-    if (start == 0 && length == std::string::npos) {
-        return std::string(str);
+    // Offsets count codepoints, each starting at a byte that isn't a
+    // continuation byte
+    auto skip = [str](size_t pos, size_t codepoints) {
+        while (pos < str.size()) {
+            if ((static_cast<unsigned char>(str[pos]) & 0xC0) != 0x80 && codepoints-- == 0) {
+                break;
+            }
+            ++pos;
+        }
+        return pos;
+    };
+    
+    size_t begin = skip(0, start);
+    size_t end = length == std::string::npos ? str.size() : skip(begin, length);
+    return std::string(str.substr(begin, end - begin));
+}
+
+namespace {
+
+constexpr size_t npos = std::string_view::npos;
+
+bool is_continuation(unsigned char byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+// The reference validator: checks every sequence starting at or after
+// `pos`, which isn't in the middle of one. Ranges are those of Table 3-7
+// in the Unicode standard.
+size_t find_invalid_from(std::string_view text, size_t pos) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    const size_t size = text.size();
+    while (pos < size) {
+        const unsigned char lead = bytes[pos];
+        if (lead < 0x80) {
+            ++pos;
+            continue;
+        }
+        size_t length;
+        unsigned char second_min = 0x80;
+        unsigned char second_max = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            second_min = lead == 0xE0 ? 0xA0 : 0x80;  // overlong
+            second_max = lead == 0xED ? 0x9F : 0xBF;  // surrogates
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            second_min = lead == 0xF0 ? 0x90 : 0x80;  // overlong
+            second_max = lead == 0xF4 ? 0x8F : 0xBF;  // above U+10FFFF
+        } else {
+            return pos;
+        }
+        if (pos + length > size || bytes[pos + 1] < second_min || bytes[pos + 1] > second_max) {
+            return pos;
+        }
+        for (size_t i = 2; i < length; ++i) {
+            if (!is_continuation(bytes[pos + i])) {
+                return pos;
+            }
+        }
+        pos += length;
+    }
+    return npos;
+}
+
+// Where the reference picks up from a block kernel at `pos`: the first
+// sequence that may still run into it, since anything that ended before
+// `pos` has been checked
+size_t resume_point(std::string_view text, size_t pos) {
+    size_t start = pos >= 3 ? pos - 3 : 0;
+    while (start < pos && is_continuation(static_cast<unsigned char>(text[start]))) {
+        ++start;
+    }
+    return start;
+}
+
+// Checks 64 bytes at a time from masks: continuation bytes must be
+// exactly where the lead bytes before them require, lead bytes that only
+// start overlong or out of range sequences (C0, C1, F5-FF) are errors
+// anywhere, and the second bytes after E0, ED, F0 and F4 have narrower
+// ranges. Blocks of ASCII with nothing carried in are skipped outright.
+// On an error, the reference finds its exact offset.
+template <typename Block>
+size_t find_invalid_blocks(std::string_view text) {
+    // Lead bytes of the previous block, for sequences that run into this one
+    uint64_t previous_two = 0;
+    uint64_t previous_three = 0;
+    uint64_t previous_four = 0;
+    unsigned char previous_last = 0;
+    size_t pos = 0;
+    while (pos + 64 <= text.size()) {
+        const Block block(text.data() + pos);
+        const uint64_t ascii = block.at_most(0x7F);
+        const uint64_t carried = previous_two >> 63 | previous_three >> 62 | previous_four >> 61;
+        if (ascii == ~uint64_t{0} && !carried) {
+            previous_two = previous_three = previous_four = 0;
+            previous_last = 0;
+            pos += 64;
+            continue;
+        }
+        
+        const uint64_t up_to_bf = block.at_most(static_cast<char>(0xBF));
+        const uint64_t up_to_df = block.at_most(static_cast<char>(0xDF));
+        const uint64_t up_to_ef = block.at_most(static_cast<char>(0xEF));
+        const uint64_t up_to_f4 = block.at_most(static_cast<char>(0xF4));
+        const uint64_t continuation = up_to_bf & ~ascii;
+        const uint64_t two = ~block.at_most(static_cast<char>(0xC1)) & up_to_df;
+        const uint64_t three = ~up_to_df & up_to_ef;
+        const uint64_t four = ~up_to_ef & up_to_f4;
+        const uint64_t required = (two << 1 | previous_two >> 63) |
+                                  (three << 1 | previous_three >> 63) | (three << 2 | previous_three >> 62) |
+                                  (four << 1 | previous_four >> 63) | (four << 2 | previous_four >> 62) |
+                                  (four << 3 | previous_four >> 61);
+        const uint64_t never_valid = (~up_to_bf & ~two & ~three & ~four);
+        
+        // Second bytes after the leads with narrower ranges
+        const uint64_t up_to_8f = block.at_most(static_cast<char>(0x8F));
+        const uint64_t up_to_9f = block.at_most(static_cast<char>(0x9F));
+        const uint64_t e0 = block.eq(static_cast<char>(0xE0));
+        const uint64_t ed = block.eq(static_cast<char>(0xED));
+        const uint64_t f0 = block.eq(static_cast<char>(0xF0));
+        const uint64_t f4 = block.eq(static_cast<char>(0xF4));
+        const uint64_t narrow = ((e0 << 1 | uint64_t{previous_last == 0xE0}) & up_to_9f) |
+                                ((ed << 1 | uint64_t{previous_last == 0xED}) & ~up_to_9f) |
+                                ((f0 << 1 | uint64_t{previous_last == 0xF0}) & up_to_8f) |
+                                ((f4 << 1 | uint64_t{previous_last == 0xF4}) & ~up_to_8f);
+        
+        if ((required ^ continuation) | never_valid | narrow) {
+            return find_invalid_from(text, resume_point(text, pos));
+        }
+        
+        previous_two = two;
+        previous_three = three;
+        previous_four = four;
+        previous_last = static_cast<unsigned char>(text[pos + 63]);
+        pos += 64;
+    }
+    return find_invalid_from(text, resume_point(text, pos));
+}
+
+// Length of the run of ASCII bytes at the start of `text`
+template <typename Block>
+size_t ascii_prefix_blocks(std::string_view text) {
+    size_t pos = 0;
+    for (; pos + 64 <= text.size(); pos += 64) {
+        const uint64_t ascii = Block(text.data() + pos).at_most(0x7F);
+        if (ascii != ~uint64_t{0}) {
+            return pos + static_cast<size_t>(__builtin_ctzll(~ascii));
+        }
+    }
+    while (pos < text.size() && static_cast<unsigned char>(text[pos]) < 0x80) {
+        ++pos;
+    }
+    return pos;
+}
+
+struct Utf8Kernels {
+    size_t (*find_invalid)(std::string_view);
+    size_t (*ascii_prefix)(std::string_view);
+};
+
+MDVIEWER_KERNEL_SCALAR size_t find_invalid_reference(std::string_view text) {
+    return find_invalid_from(text, 0);
+}
+
+MDVIEWER_KERNEL_SCALAR size_t ascii_prefix_scalar(std::string_view text) {
+    size_t pos = 0;
+    while (pos < text.size() && static_cast<unsigned char>(text[pos]) < 0x80) {
+        ++pos;
+    }
+    return pos;
+}
+
+#if defined(MDVIEWER_SIMD_X86)
+MDVIEWER_KERNEL_SSE42 size_t find_invalid_sse42(std::string_view text) {
+    return find_invalid_blocks<simd::Sse42Block>(text);
+}
+
+MDVIEWER_KERNEL_SSE42 size_t ascii_prefix_sse42(std::string_view text) {
+    return ascii_prefix_blocks<simd::Sse42Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX2 size_t find_invalid_avx2(std::string_view text) {
+    return find_invalid_blocks<simd::Avx2Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX2 size_t ascii_prefix_avx2(std::string_view text) {
+    return ascii_prefix_blocks<simd::Avx2Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX512 size_t find_invalid_avx512(std::string_view text) {
+    return find_invalid_blocks<simd::Avx512Block>(text);
+}
+
+MDVIEWER_KERNEL_AVX512 size_t ascii_prefix_avx512(std::string_view text) {
+    return ascii_prefix_blocks<simd::Avx512Block>(text);
+}
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+MDVIEWER_KERNEL_NEON size_t find_invalid_neon(std::string_view text) {
+    return find_invalid_blocks<simd::NeonBlock>(text);
+}
+
+MDVIEWER_KERNEL_NEON size_t ascii_prefix_neon(std::string_view text) {
+    return ascii_prefix_blocks<simd::NeonBlock>(text);
+}
+#endif
+
+Utf8Kernels utf8_kernels_for(SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        return {find_invalid_reference, ascii_prefix_scalar};
+    }
+    switch (level) {
+#if defined(MDVIEWER_SIMD_X86)
+        case SimdLevel::SSE42:
+            return {find_invalid_sse42, ascii_prefix_sse42};
+        case SimdLevel::AVX2:
+            return {find_invalid_avx2, ascii_prefix_avx2};
+        case SimdLevel::AVX512:
+            return {find_invalid_avx512, ascii_prefix_avx512};
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+        case SimdLevel::NEON:
+            return {find_invalid_neon, ascii_prefix_neon};
+#endif
+        default:
+            return {find_invalid_reference, ascii_prefix_scalar};
+    }
+}
+
+const Utf8Kernels& active_utf8_kernels() {
+    static const Utf8Kernels kernels = utf8_kernels_for(SimdDispatch::active());
+    return kernels;
+}
+
+// Windows-1252's 0x80-0x9F; the five bytes it leaves undefined map to
+// the C1 controls, as browsers decode them
+constexpr uint16_t kWindows1252High[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+constexpr uint32_t kReplacement = 0xFFFD;
+
+char* encode(uint32_t cp, char* out) {
+    if (cp < 0x80) {
+        *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        *out++ = static_cast<char>(0xC0 | cp >> 6);
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | cp >> 12);
+        *out++ = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | cp >> 18);
+        *out++ = static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+uint32_t single_byte(unsigned char byte, bool windows1252) {
+    return windows1252 && byte >= 0x80 && byte < 0xA0 ? kWindows1252High[byte - 0x80] : byte;
+}
+
+// Latin-1 and Windows-1252: ASCII runs are copied whole, the rest is a
+// table lookup per byte. At most three bytes out per byte in.
+char* single_byte_to_utf8(std::string_view bytes, bool windows1252, char* out) {
+    const auto& kernels = active_utf8_kernels();
+    size_t pos = 0;
+    while (pos < bytes.size()) {
+        size_t run = kernels.ascii_prefix(bytes.substr(pos));
+        std::memcpy(out, bytes.data() + pos, run);
+        out += run;
+        pos += run;
+        // Non-ASCII bytes tend to come one at a time between ASCII runs
+        while (pos < bytes.size() && static_cast<unsigned char>(bytes[pos]) >= 0x80) {
+            out = encode(single_byte(static_cast<unsigned char>(bytes[pos]), windows1252), out);
+            ++pos;
+        }
     }
+    return out;
+}
+
+// UTF-16: four ASCII code units at a time where possible, surrogate pairs
+// combined. At most three bytes out per two in.
+char* utf16_to_utf8(std::string_view bytes, bool big_endian, bool lossy, char* out, bool& ok) {
+    const auto* data = reinterpret_cast<const unsigned char*>(bytes.data());
+    const size_t units = bytes.size() / 2;
+    auto unit = [&](size_t i) -> uint32_t {
+        return big_endian ? (data[2 * i] << 8 | data[2 * i + 1]) : (data[2 * i + 1] << 8 | data[2 * i]);
+    };
+    // Four units loaded on a little-endian host are ASCII when none of
+    // these bits are set: each unit's high byte, and the top of its low one
+    constexpr bool little_endian_host = std::endian::native == std::endian::little;
+    const uint64_t non_ascii = big_endian ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL;
     
-    // For now, treat as regular string
-    if (start >= str.size()) {
-        return "";
+    ok = true;
+    size_t i = 0;
+    while (i < units) {
+        if (little_endian_host && i + 4 <= units) {
+            uint64_t four;
+            std::memcpy(&four, data + 2 * i, 8);
+            if (!(four & non_ascii)) {
+                const size_t low = big_endian ? 1 : 0;
+                out[0] = static_cast<char>(data[2 * i + low]);
+                out[1] = static_cast<char>(data[2 * i + 2 + low]);
+                out[2] = static_cast<char>(data[2 * i + 4 + low]);
+                out[3] = static_cast<char>(data[2 * i + 6 + low]);
+                out += 4;
+                i += 4;
+                continue;
+            }
+        }
+        
+        uint32_t cp = unit(i++);
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+            const bool paired = cp <= 0xDBFF && i < units && unit(i) >= 0xDC00 && unit(i) <= 0xDFFF;
+            if (paired) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (unit(i++) - 0xDC00);
+            } else if (lossy) {
+                cp = kReplacement;
+            } else {
+                ok = false;
+                return out;
+            }
+        }
+        out = encode(cp, out);
+    }
+    if (bytes.size() % 2) {
+        if (!lossy) {
+            ok = false;
+            return out;
+        }
+        out = encode(kReplacement, out);
+    }
+    return out;
+}
+
+// UTF-8: valid runs are copied whole; each byte that starts no valid
+// sequence is read as Windows-1252 when lossy. At most three bytes out per
+// byte in.
+char* utf8_to_utf8(std::string_view bytes, bool lossy, char* out, bool& ok) {
+    const auto& kernels = active_utf8_kernels();
+    ok = true;
+    size_t pos = 0;
+    while (pos < bytes.size()) {
+        size_t invalid = kernels.find_invalid(bytes.substr(pos));
+        size_t run = invalid == npos ? bytes.size() - pos : invalid;
+        std::memcpy(out, bytes.data() + pos, run);
+        out += run;
+        pos += run;
+        if (invalid == npos) {
+            break;
+        }
+        if (!lossy) {
+            ok = false;
+            return out;
+        }
+        out = encode(single_byte(static_cast<unsigned char>(bytes[pos]), true), out);
+        ++pos;
+    }
+    return out;
+}
+
+} // namespace
+
+size_t StringUtils::find_invalid_utf8(std::string_view str) {
+    return active_utf8_kernels().find_invalid(str);
+}
+
+size_t StringUtils::find_invalid_utf8(std::string_view str, SimdLevel level) {
+    return utf8_kernels_for(level).find_invalid(str);
+}
+
+bool StringUtils::is_valid_utf8(std::string_view str) {
+    return find_invalid_utf8(str) == npos;
+}
+
+StringUtils::Encoding StringUtils::detect_encoding(std::string_view bytes, size_t* bom_length) {
+    auto found = [bom_length](Encoding encoding, size_t length) {
+        if (bom_length) {
+            *bom_length = length;
+        }
+        return encoding;
+    };
+    if (starts_with(bytes, "\xEF\xBB\xBF")) {
+        return found(Encoding::UTF8, 3);
+    }
+    if (starts_with(bytes, "\xFF\xFE")) {
+        return found(Encoding::UTF16LE, 2);
+    }
+    if (starts_with(bytes, "\xFE\xFF")) {
+        return found(Encoding::UTF16BE, 2);
+    }
+    
+    // Markdown is mostly ASCII, so UTF-16 without a mark shows up as zero
+    // high bytes in most of the first few hundred code units
+    const size_t units = std::min<size_t>(bytes.size(), 512) / 2;
+    size_t zero_even = 0;
+    size_t zero_odd = 0;
+    for (size_t i = 0; i < units; ++i) {
+        zero_even += bytes[2 * i] == '\0';
+        zero_odd += bytes[2 * i + 1] == '\0';
+    }
+    if (units >= 2 && zero_odd * 4 >= units * 3 && zero_even * 20 < units) {
+        return found(Encoding::UTF16LE, 0);
+    }
+    if (units >= 2 && zero_even * 4 >= units * 3 && zero_odd * 20 < units) {
+        return found(Encoding::UTF16BE, 0);
+    }
+    return found(Encoding::UTF8, 0);
+}
+
+bool StringUtils::to_utf8(std::string_view bytes, Encoding encoding, std::string& out, bool lossy) {
+    // Sized for the worst case up front, written through a pointer, and
+    // trimmed to what was written
+    const size_t start = out.size();
+    const size_t worst = encoding == Encoding::Latin1 ? 2 * bytes.size() : 3 * bytes.size() + 3;
+    out.resize(start + worst);
+    char* begin = out.data() + start;
+    char* end = begin;
+    bool ok = true;
+    switch (encoding) {
+        case Encoding::UTF8:
+            end = utf8_to_utf8(bytes, lossy, begin, ok);
+            break;
+        case Encoding::UTF16LE:
+        case Encoding::UTF16BE:
+            end = utf16_to_utf8(bytes, encoding == Encoding::UTF16BE, lossy, begin, ok);
+            break;
+        case Encoding::Latin1:
+        case Encoding::Windows1252:
+            end = single_byte_to_utf8(bytes, encoding == Encoding::Windows1252, begin);
+            break;
+    }
+    out.resize(start + static_cast<size_t>(end - begin));
+    return ok;
+}
+
+namespace {
+
+// What an escaped character becomes; empty for the rest
+std::string_view html_escape(char c) {
+    switch (c) {
+        case '<': return "&lt;";
+        case '>': return "&gt;";
+        case '&': return "&amp;";
+        case '"': return "&quot;";
+        case '\'': return "&#39;";
+        default: return {};
+    }
+}
+
+// Escapes padded to eight bytes, so each is written with one store
+struct HtmlEscape {
+    char text[8];
+    size_t length;
+};
+
+// Indexed by the character's low five bits, which tell the five apart
+constexpr auto kPaddedEscapes = [] {
+    std::array<HtmlEscape, 32> escapes{};
+    escapes['<' & 31] = {"&lt;", 4};
+    escapes['>' & 31] = {"&gt;", 4};
+    escapes['&' & 31] = {"&amp;", 5};
+    escapes['"' & 31] = {"&quot;", 6};
+    escapes['\'' & 31] = {"&#39;", 5};
+    return escapes;
+}();
+
+const HtmlEscape& padded_escape(char c) {
+    return kPaddedEscapes[c & 31];
+}
+
+// Input is escaped a slice at a time. A first pass over the masks counts
+// what the slice grows by, so that its output is sized exactly and then
+// written through a pointer; a slice with nothing to escape is appended
+// as it is. Each 64-byte block without markup is one copy.
+template <typename Block>
+void escape_blocks(std::string_view text, std::string& out) {
+    constexpr size_t kSlice = 16 * 1024;
+    auto masks = [](const Block& block, uint64_t& short_escapes, uint64_t& long_escapes) {
+        short_escapes = block.eq('<') | block.eq('>');
+        long_escapes = block.eq('&') | block.eq('\'');
+        const uint64_t quotes = block.eq('"');
+        return short_escapes | long_escapes | quotes;
+    };
+    for (size_t begin = 0; begin < text.size(); begin += kSlice) {
+        const std::string_view slice = text.substr(begin, kSlice);
+        const size_t blocks_end = slice.size() / 64 * 64;
+        size_t grows = 0;
+        for (size_t pos = 0; pos < blocks_end; pos += 64) {
+            uint64_t short_escapes, long_escapes;
+            const uint64_t special = masks(Block(slice.data() + pos), short_escapes, long_escapes);
+            // Three bytes more for < and >, four for & and ', five for "
+            grows += 5 * __builtin_popcountll(special) - 2 * __builtin_popcountll(short_escapes) -
+                     __builtin_popcountll(long_escapes);
+        }
+        for (size_t pos = blocks_end; pos < slice.size(); ++pos) {
+            grows += html_escape(slice[pos]).size() - !html_escape(slice[pos]).empty();
+        }
+        if (grows == 0) {
+            out.append(slice);
+            continue;
+        }
+        
+        const size_t start = out.size();
+        const size_t length = slice.size() + grows;
+        out.resize(start + length + sizeof(HtmlEscape::text));
+        char* dest = out.data() + start;
+        auto write_escape = [&dest](char c) {
+            const HtmlEscape& escape = padded_escape(c);
+            std::memcpy(dest, escape.text, sizeof(escape.text));
+            dest += escape.length;
+        };
+        for (size_t pos = 0; pos < blocks_end; pos += 64) {
+            const char* src = slice.data() + pos;
+            uint64_t short_escapes, long_escapes;
+            uint64_t special = masks(Block(src), short_escapes, long_escapes);
+            size_t copied = 0;
+            while (special) {
+                const size_t at = static_cast<size_t>(__builtin_ctzll(special));
+                std::memcpy(dest, src + copied, at - copied);
+                dest += at - copied;
+                write_escape(src[at]);
+                copied = at + 1;
+                special &= special - 1;
+            }
+            std::memcpy(dest, src + copied, 64 - copied);
+            dest += 64 - copied;
+        }
+        for (size_t pos = blocks_end; pos < slice.size(); ++pos) {
+            if (html_escape(slice[pos]).empty()) {
+                *dest++ = slice[pos];
+            } else {
+                write_escape(slice[pos]);
+            }
+        }
+        out.resize(start + length);
+    }
+}
+
+using EscapeHtml = void (*)(std::string_view, std::string&);
+
+MDVIEWER_KERNEL_SCALAR void escape_reference(std::string_view text, std::string& out) {
+    out.reserve(out.size() + text.size() + text.size() / 8);
+    for (char c : text) {
+        const std::string_view escaped = html_escape(c);
+        if (escaped.empty()) {
+            out += c;
+        } else {
+            out.append(escaped);
+        }
+    }
+}
+
+#if defined(MDVIEWER_SIMD_X86)
+MDVIEWER_KERNEL_SSE42 void escape_sse42(std::string_view text, std::string& out) {
+    escape_blocks<simd::Sse42Block>(text, out);
+}
+
+MDVIEWER_KERNEL_AVX2 void escape_avx2(std::string_view text, std::string& out) {
+    escape_blocks<simd::Avx2Block>(text, out);
+}
+
+MDVIEWER_KERNEL_AVX512 void escape_avx512(std::string_view text, std::string& out) {
+    escape_blocks<simd::Avx512Block>(text, out);
+}
+#endif
+
+#if defined(MDVIEWER_SIMD_NEON)
+MDVIEWER_KERNEL_NEON void escape_neon(std::string_view text, std::string& out) {
+    escape_blocks<simd::NeonBlock>(text, out);
+}
+#endif
+
+EscapeHtml escape_html_for(SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        return escape_reference;
+    }
+    switch (level) {
+#if defined(MDVIEWER_SIMD_X86)
+        case SimdLevel::SSE42:
+            return escape_sse42;
+        case SimdLevel::AVX2:
+            return escape_avx2;
+        case SimdLevel::AVX512:
+            return escape_avx512;
+#endif
+#if defined(MDVIEWER_SIMD_NEON)
+        case SimdLevel::NEON:
+            return escape_neon;
+#endif
+        default:
+            return escape_reference;
+    }
+}
+
+int digit_value(char c, bool hex) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    const char lower = static_cast<char>(c | 0x20);
+    return hex && lower >= 'a' && lower <= 'f' ? lower - 'a' + 10 : -1;
+}
+
+bool is_name_char(char c) {
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+}
+
+// Decodes the character reference at the start of `text`, which follows
+// an &, onto `out`. Returns the bytes it took, or 0 when there is none.
+size_t decode_reference(std::string_view text, std::string& out) {
+    size_t pos = 0;
+    if (!text.empty() && text[0] == '#') {
+        const bool hex = text.size() > 1 && (text[1] | 0x20) == 'x';
+        pos = hex ? 2 : 1;
+        const size_t digits = pos;
+        uint32_t cp = 0;
+        for (int digit; pos < text.size() && (digit = digit_value(text[pos], hex)) >= 0; ++pos) {
+            // Saturates past the last codepoint
+            cp = std::min<uint32_t>(cp * (hex ? 16 : 10) + static_cast<uint32_t>(digit), 0x110000);
+        }
+        if (pos == digits || pos == text.size() || text[pos] != ';') {
+            return 0;
+        }
+        // As HTML5 decodes them: C1 controls as the Windows-1252 characters
+        // they almost always stand for, and the impossible as U+FFFD
+        if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            cp = kReplacement;
+        } else if (cp >= 0x80 && cp < 0xA0) {
+            cp = single_byte(static_cast<unsigned char>(cp), true);
+        }
+        char buffer[4];
+        out.append(buffer, encode(cp, buffer));
+        return pos + 1;
     }
     
-    size_t end_pos = (length == std::string::npos) ? str.size() : std::min(start + length, str.size());
-    return std::string(str.substr(start, end_pos - start));
+    while (pos < text.size() && pos <= html_entities::kLongestName && is_name_char(text[pos])) {
+        ++pos;
+    }
+    if (pos == 0 || pos == text.size() || text[pos] != ';') {
+        return 0;
+    }
+    const html_entities::Entity* entity = html_entities::find(text.substr(0, pos));
+    if (!entity) {
+        return 0;
+    }
+    out.append(entity->utf8);
+    return pos + 1;
+}
+
+} // namespace
+
+void StringUtils::escape_html(std::string_view str, std::string& out) {
+    static const EscapeHtml escape = escape_html_for(SimdDispatch::active());
+    escape(str, out);
+}
+
+void StringUtils::escape_html(std::string_view str, std::string& out, SimdLevel level) {
+    escape_html_for(level)(str, out);
+}
+
+void StringUtils::unescape_html(std::string_view str, std::string& out) {
+    out.reserve(out.size() + str.size());
+    size_t pos = 0;
+    while (pos < str.size()) {
+        const void* found = std::memchr(str.data() + pos, '&', str.size() - pos);
+        const size_t amp = found ? static_cast<const char*>(found) - str.data() : str.size();
+        out.append(str.data() + pos, amp - pos);
+        if (amp == str.size()) {
+            break;
+        }
+        const size_t taken = decode_reference(str.substr(amp + 1), out);
+        if (taken == 0) {
+            out += '&';
+        }
+        pos = amp + 1 + taken;
+    }
 }
 
-} // namespace mdviewer
\ No newline at end of file
+} // namespace mdviewer
@@ -1,11 +1,70 @@
 #include <benchmark/benchmark.h>
 #include "core/markdown_parser.h"
 #include "core/document.h"
+#include "core/streaming_parser.h"
+#include "core/document_cache.h"
+#include "core/mapped_file.h"
+#include "core/structural_scanner.h"
+#include "core/text_counter.h"
+#include "core/text_offset_map.h"
+#include "core/toc_generator.h"
+#include "core/toc_diff.h"
+#include "core/node_visitor.h"
+#include "utils/file_utils.h"
+#include "utils/string_utils.h"
+#include <deque>
+#include <filesystem>
+#include <fstream>
 #include <random>
+#include <regex>
 #include <sstream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
 
 using namespace mdviewer;
 
+// Global allocation counters so parse benchmarks can report heap traffic
+static std::atomic<size_t> g_allocation_count{0};
+static std::atomic<size_t> g_allocated_bytes{0};
+
+void* operator new(size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+// Memory resources ask for their blocks with an alignment
+void* operator new(size_t size, std::align_val_t align) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    size_t alignment = static_cast<size_t>(align);
+    if (void* ptr = std::aligned_alloc(alignment, (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
 static std::string generate_markdown(size_t paragraphs, size_t words_per_paragraph) {
     std::stringstream ss;
     std::random_device rd;
@@ -77,6 +136,7 @@ BENCHMARK(BM_ParseLargeDocument);
 
 static void BM_Parse10MBDocument(benchmark::State& state) {
     MarkdownParser parser;
+    parser.enable_arena_allocation(state.range(0) != 0);
     std::string markdown;
     
     // Generate approximately 10MB of markdown
@@ -84,15 +144,163 @@ static void BM_Parse10MBDocument(benchmark::State& state) {
         markdown += generate_markdown(100, 100);
     }
     
+    // Teardown happens inside the timed loop so arena release is measured too
+    size_t allocations = 0;
+    size_t allocated_bytes = 0;
     for (auto _ : state) {
+        size_t count_before = g_allocation_count.load(std::memory_order_relaxed);
+        size_t bytes_before = g_allocated_bytes.load(std::memory_order_relaxed);
         auto doc = parser.parse(markdown);
         benchmark::DoNotOptimize(doc);
+        doc.reset();
+        allocations += g_allocation_count.load(std::memory_order_relaxed) - count_before;
+        allocated_bytes += g_allocated_bytes.load(std::memory_order_relaxed) - bytes_before;
     }
     
+    double megabytes = static_cast<double>(markdown.size()) / (1024 * 1024);
     state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.counters["allocs/parse"] = static_cast<double>(allocations) / state.iterations();
+    state.counters["heap_bytes/MB"] = static_cast<double>(allocated_bytes) / state.iterations() / megabytes;
     state.SetLabel("Size: " + std::to_string(markdown.size() / (1024 * 1024)) + " MB");
 }
-BENCHMARK(BM_Parse10MBDocument)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parse10MBDocument)->ArgName("arena")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadCached10MBDocument(benchmark::State& state) {
+    MarkdownParser parser;
+    std::string markdown;
+    while (markdown.size() < 10 * 1024 * 1024) {
+        markdown += generate_markdown(100, 100);
+    }
+    
+    auto entry = std::filesystem::temp_directory_path() / "inkwell_bench_cache.inkdoc";
+    DocumentCache::write_entry(entry, *parser.parse(markdown), parser.options_key());
+    
+    // Hash check, page-in and tree rebuild; compare with BM_Parse10MBDocument
+    for (auto _ : state) {
+        auto doc = DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key());
+        if (!doc) {
+            state.SkipWithError("cache entry rejected");
+            break;
+        }
+        benchmark::DoNotOptimize(doc);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.counters["entry_bytes"] = static_cast<double>(std::filesystem::file_size(entry));
+    std::filesystem::remove(entry);
+}
+BENCHMARK(BM_LoadCached10MBDocument)->Unit(benchmark::kMillisecond);
+
+// Getting a 100 MB file's bytes in front of the parser: 0 through
+// FileUtils::read_file, 1 mapped by MappedFile. Counting the words touches
+// every page, so the mapping pays its page-in inside the loop too.
+static void BM_Load100MBFile(benchmark::State& state) {
+    auto path = std::filesystem::temp_directory_path() / "inkwell_bench_load.md";
+    size_t size = 0;
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        std::string chunk = generate_markdown(1000, 100);
+        for (; size < 100 * 1024 * 1024; size += chunk.size()) {
+            file << chunk;
+        }
+    }
+    
+    for (auto _ : state) {
+        size_t words = 0;
+        if (state.range(0) == 0) {
+            auto markdown = FileUtils::read_file(path);
+            words = TextCounter::count_words(*markdown);
+        } else {
+            auto file = MappedFile::open(path);
+            words = TextCounter::count_words(file->bytes());
+        }
+        benchmark::DoNotOptimize(words);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * size);
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_Load100MBFile)->ArgName("mapped")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseParallel64MBDocument(benchmark::State& state) {
+    MarkdownParser parser;
+    parser.set_parse_threads(static_cast<size_t>(state.range(0)));
+    std::string markdown;
+    while (markdown.size() < 64 * 1024 * 1024) {
+        markdown += generate_markdown(100, 100);
+    }
+    
+    for (auto _ : state) {
+        auto doc = parser.parse(markdown);
+        benchmark::DoNotOptimize(doc);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.SetLabel("Size: " + std::to_string(markdown.size() / (1024 * 1024)) + " MB");
+}
+// Wall time, since the point is how it scales across cores
+BENCHMARK(BM_ParseParallel64MBDocument)->ArgName("threads")->RangeMultiplier(2)->Range(1, 16)
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_Reparse20MBSingleCharEdit(benchmark::State& state) {
+    MarkdownParser parser;
+    std::string markdown;
+    while (markdown.size() < 20 * 1024 * 1024) {
+        markdown += generate_markdown(100, 100);
+    }
+    auto doc = parser.parse(markdown);
+    
+    // Type a character into a paragraph in the middle, then delete it again
+    size_t offset = markdown.find(' ', markdown.size() / 2);
+    bool typed = false;
+    for (auto _ : state) {
+        MarkdownParser::Edit edit = typed ? MarkdownParser::Edit{offset, 1, ""}
+                                          : MarkdownParser::Edit{offset, 0, "x"};
+        parser.reparse(*doc, edit);
+        typed = !typed;
+    }
+    
+    state.SetLabel("Size: " + std::to_string(markdown.size() / (1024 * 1024)) + " MB");
+}
+BENCHMARK(BM_Reparse20MBSingleCharEdit)->Unit(benchmark::kMillisecond);
+
+// The same edits as new versions, keeping the last eight alive as readers
+// would. "Tree bytes" is what each version allocates beyond its copy of the
+// source: a typed character shifts every block after it, which is copied;
+// a replaced one leaves them all shared.
+static void BM_ReparseVersion20MB(benchmark::State& state) {
+    MarkdownParser parser;
+    std::string markdown;
+    while (markdown.size() < 20 * 1024 * 1024) {
+        markdown += generate_markdown(100, 100);
+    }
+    std::shared_ptr<const Document> version = parser.parse(markdown);
+    std::deque<std::shared_ptr<const Document>> retained;
+    
+    size_t offset = markdown.find(' ', markdown.size() / 2);
+    bool typed = false;
+    size_t bytes = 0;
+    for (auto _ : state) {
+        MarkdownParser::Edit edit = state.range(0) == 0 ? MarkdownParser::Edit{offset, 1, typed ? " " : "x"}
+                                  : typed ? MarkdownParser::Edit{offset, 1, ""}
+                                          : MarkdownParser::Edit{offset, 0, "x"};
+        auto edited = std::make_shared<std::string>(version->source());
+        edited->replace(edit.offset, edit.removed_len, edit.inserted_text);
+        
+        size_t before = g_allocated_bytes.load(std::memory_order_relaxed);
+        version = parser.reparse_version(version, edit, *edited, edited);
+        bytes += g_allocated_bytes.load(std::memory_order_relaxed) - before;
+        
+        retained.push_back(version);
+        if (retained.size() > 8) {
+            retained.pop_front();
+        }
+        typed = !typed;
+    }
+    
+    state.counters["tree_bytes"] = benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ReparseVersion20MB)->ArgName("shifting")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
 
 static void BM_WikilinkDetection(benchmark::State& state) {
     MarkdownParser parser;
@@ -133,6 +341,33 @@ static void BM_WikilinkDetectionLarge(benchmark::State& state) {
 }
 BENCHMARK(BM_WikilinkDetectionLarge)->Unit(benchmark::kMillisecond);
 
+static void BM_StructuralScanVault(benchmark::State& state) {
+    // Notes as they look in a vault: prose with the odd link, embed, tag,
+    // code span and fenced block
+    const std::string prose = generate_markdown(3, 60);
+    std::string text;
+    for (int i = 0; text.size() < 16 * 1024 * 1024; ++i) {
+        text += "## Note " + std::to_string(i) + "\n\n";
+        text += prose;
+        text += "Related: [[Topic " + std::to_string(i % 97) + "|topic]] and ![[figure" +
+                std::to_string(i) + ".png]] #project/" + std::to_string(i % 13) + "x\n";
+        text += "Call `render([[not a link]])` before saving.\n\n```cpp\nauto x = a[[b]];\n```\n\n";
+    }
+    
+    size_t link_count = 0;
+    for (auto _ : state) {
+        std::vector<Document::Link> links;
+        std::vector<StructuralScanner::Tag> tags;
+        StructuralScanner::scan(text, links, &tags);
+        link_count = links.size();
+        benchmark::DoNotOptimize(tags);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetLabel(std::string(SimdDispatch::name(SimdDispatch::active())) + ", links: " + std::to_string(link_count));
+}
+BENCHMARK(BM_StructuralScanVault)->Unit(benchmark::kMillisecond);
+
 static void BM_WordCount(benchmark::State& state) {
     MarkdownParser parser;
     std::string markdown = generate_markdown(100, 100);
@@ -153,6 +388,8 @@ static void BM_WordCountLarge(benchmark::State& state) {
     auto doc = parser.parse(markdown);
     
     for (auto _ : state) {
+        // word_count() is cached; drop the cache so every pass counts
+        doc->mark_modified();
         auto count = doc->word_count();
         benchmark::DoNotOptimize(count);
     }
@@ -162,6 +399,316 @@ static void BM_WordCountLarge(benchmark::State& state) {
 }
 BENCHMARK(BM_WordCountLarge);
 
+static void BM_SectionStats(benchmark::State& state) {
+    MarkdownParser parser;
+    std::string markdown = generate_markdown(1000, 200);
+    auto doc = parser.parse(markdown);
+    std::vector<const Document::Node*> headings;
+    for (const auto& block : doc->get_root()->children) {
+        if (block->type == Document::NodeType::Heading) {
+            headings.push_back(block.get());
+        }
+    }
+    doc->stats();
+    
+    for (auto _ : state) {
+        size_t words = 0;
+        for (const auto* heading : headings) {
+            words += doc->section_stats(heading).words;
+        }
+        benchmark::DoNotOptimize(words);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * headings.size());
+    state.SetLabel("Sections: " + std::to_string(headings.size()));
+}
+BENCHMARK(BM_SectionStats);
+
+// Prose with the accents and typographic punctuation real notes have,
+// plus a CJK paragraph every so often
+static std::string generate_unicode_prose(size_t paragraphs) {
+    std::string text;
+    for (size_t p = 0; p < paragraphs; ++p) {
+        if (p % 10 == 9) {
+            text += "\u4E2D\u6587\u6BB5\u843D\u91CC\u6CA1\u6709\u7A7A\u683C\uFF0C\u6BCF\u4E2A\u5B57\u90FD\u7B97\u4E00\u4E2A\u8BCD\u3002\n\n";
+            continue;
+        }
+        for (int sentence = 0; sentence < 8; ++sentence) {
+            text += "The caf\u00E9 on the corner \u2014 the one with \u201Cgood\u201D coffee \u2014 isn\u2019t open on Mondays. ";
+        }
+        text += "\n\n";
+    }
+    return text;
+}
+
+static void BM_TextCount(benchmark::State& state, SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        state.SkipWithError("not supported on this CPU");
+        return;
+    }
+    std::string text = generate_unicode_prose(2000);
+    
+    for (auto _ : state) {
+        auto counts = TextCounter::count(text, level);
+        benchmark::DoNotOptimize(counts);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetLabel(SimdDispatch::name(level));
+}
+BENCHMARK_CAPTURE(BM_TextCount, scalar, SimdLevel::Scalar);
+BENCHMARK_CAPTURE(BM_TextCount, active, SimdDispatch::active());
+
+// About 10 MB of prose in UTF-8 with an accented letter every few words
+static const std::string& accented_markdown() {
+    static const std::string markdown = [] {
+        std::string text = generate_markdown(12000, 120);
+        for (size_t pos = 37; pos + 1 < text.size(); pos += 41) {
+            if (text[pos] >= 'a' && text[pos] <= 'z' && text[pos + 1] >= 'a' && text[pos + 1] <= 'z') {
+                text.replace(pos, 2, "\u00E9");
+            }
+        }
+        return text;
+    }();
+    return markdown;
+}
+
+static void BM_ValidateUtf8(benchmark::State& state, SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        state.SkipWithError("not supported on this CPU");
+        return;
+    }
+    const std::string& markdown = accented_markdown();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(StringUtils::find_invalid_utf8(markdown, level));
+    }
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+}
+BENCHMARK_CAPTURE(BM_ValidateUtf8, scalar, SimdLevel::Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ValidateUtf8, active, SimdDispatch::active())->Unit(benchmark::kMillisecond);
+
+// The same note as it arrives from older tools: 0 Windows-1252, 1 UTF-16LE,
+// 2 UTF-8 with Windows-1252 pasted in every few hundred bytes
+static void BM_TranscodeToUtf8(benchmark::State& state) {
+    const std::string& markdown = accented_markdown();
+    std::string input;
+    StringUtils::Encoding encoding = StringUtils::Encoding::UTF8;
+    switch (state.range(0)) {
+        case 0:
+            encoding = StringUtils::Encoding::Windows1252;
+            for (size_t pos = 0; pos < markdown.size(); ++pos) {
+                bool accent = markdown.compare(pos, 2, "\u00E9") == 0;
+                input += accent ? '\xE9' : markdown[pos];
+                pos += accent;
+            }
+            break;
+        case 1:
+            encoding = StringUtils::Encoding::UTF16LE;
+            for (char c : generate_markdown(12000, 120)) {
+                input += c;
+                input += '\0';
+            }
+            break;
+        default:
+            input = markdown;
+            for (size_t pos = 0; pos < input.size(); pos += 397) {
+                input[pos] = '\x93';
+            }
+            break;
+    }
+    
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        StringUtils::to_utf8(input, encoding, out, true);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_TranscodeToUtf8)->ArgName("cp1252_utf16_mixed")->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+// About 1 MB of text for the HTML escaper: 0 clean prose, 1 inline markup
+// every few words, 2 nothing but characters to escape
+static std::string html_escape_input(int64_t kind) {
+    std::string text;
+    while (text.size() < 1024 * 1024) {
+        switch (kind) {
+            case 0:
+                text += "Plain prose with accents, caf\u00E9 and na\u00EFve, and nothing to escape. ";
+                break;
+            case 1:
+                text += "Use <b>bold</b> & \"quotes\" when it's <i>needed</i>. ";
+                break;
+            default:
+                text += "<>&\"'";
+                break;
+        }
+    }
+    return text;
+}
+
+static void BM_EscapeHtml(benchmark::State& state) {
+    const std::string text = html_escape_input(state.range(0));
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        StringUtils::escape_html(text, buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_EscapeHtml)->ArgName("clean_markup_all")->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+// 0 text without references, 1 named and numeric ones every few words,
+// 2 ampersands and names that never turn out to be references
+static void BM_UnescapeHtml(benchmark::State& state) {
+    std::string text;
+    while (text.size() < 1024 * 1024) {
+        switch (state.range(0)) {
+            case 0:
+                text += "Plain prose with accents, caf\u00E9 and na\u00EFve, and nothing to decode. ";
+                break;
+            case 1:
+                text += "&ldquo;Caf&eacute;&rdquo; &amp; &#x2014; &lt;tag&gt; &#233;t&#xE9; &hellip; ";
+                break;
+            default:
+                text += "&&& &CounterClockwiseContourIntegralX; &#99999999999 &notanentityatall; ";
+                break;
+        }
+    }
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        StringUtils::unescape_html(text, buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_UnescapeHtml)->ArgName("none_dense_nearmiss")->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+// Prose of state.range(0) bytes, in lines of mixed case with padding
+static std::string string_utils_input(size_t size) {
+    static const std::string line = "  The Quick Brown Fox, jumps over the Lazy Dog; again and Again.  \n";
+    std::string text;
+    text.reserve(size + line.size());
+    while (text.size() < size) {
+        text += line;
+    }
+    text.resize(size);
+    return text;
+}
+
+static void BM_StringSplitLines(benchmark::State& state) {
+    const std::string text = string_utils_input(state.range(0));
+    for (auto _ : state) {
+        size_t total = 0;
+        for (std::string_view line : StringUtils::lines(text)) {
+            total += StringUtils::trim_view(line).size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StringSplitLines)->Arg(10)->Arg(1024)->Arg(1024 * 1024)->Arg(100 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+
+static void BM_StringSplit(benchmark::State& state) {
+    const std::string text = string_utils_input(state.range(0));
+    for (auto _ : state) {
+        auto pieces = StringUtils::split(text, '\n');
+        benchmark::DoNotOptimize(pieces.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StringSplit)->Arg(10)->Arg(1024)->Arg(1024 * 1024)->Arg(100 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+
+static void BM_StringToLower(benchmark::State& state) {
+    const std::string text = string_utils_input(state.range(0));
+    std::string buffer;
+    for (auto _ : state) {
+        buffer = text;
+        StringUtils::to_lower_in_place(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StringToLower)->Arg(10)->Arg(1024)->Arg(1024 * 1024)->Arg(100 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+
+static void BM_StringReplaceAll(benchmark::State& state) {
+    const std::string text = string_utils_input(state.range(0));
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        StringUtils::replace_all(text, "Lazy", "Sleepy", buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StringReplaceAll)->Arg(10)->Arg(1024)->Arg(1024 * 1024)->Arg(100 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+
+static void BM_OffsetMapBuild(benchmark::State& state, SimdLevel level) {
+    if (!SimdDispatch::supported(level)) {
+        state.SkipWithError("not supported on this CPU");
+        return;
+    }
+    const std::string& markdown = accented_markdown();
+    for (auto _ : state) {
+        TextOffsetMap map(markdown, level);
+        benchmark::DoNotOptimize(map.utf16_length());
+    }
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+}
+BENCHMARK_CAPTURE(BM_OffsetMapBuild, scalar, SimdLevel::Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_OffsetMapBuild, active, SimdDispatch::active())->Unit(benchmark::kMillisecond);
+
+// Source offsets to text view ranges and back, across 10 MB: 0 counts from
+// the start of the text each time, as the renderer did, 1 asks the map
+static void BM_OffsetMapLookup(benchmark::State& state) {
+    const std::string& markdown = accented_markdown();
+    const TextOffsetMap map(markdown);
+    std::mt19937 gen(42);
+    std::vector<size_t> offsets(state.range(0) == 0 ? 10 : 1000);
+    for (size_t& offset : offsets) {
+        offset = gen() % markdown.size();
+    }
+    for (auto _ : state) {
+        for (size_t offset : offsets) {
+            if (state.range(0) == 0) {
+                size_t units = StringUtils::utf8_length(std::string_view(markdown).substr(0, offset));
+                benchmark::DoNotOptimize(units);
+            } else {
+                benchmark::DoNotOptimize(map.byte_from_utf16(map.utf16_from_byte(offset)));
+                benchmark::DoNotOptimize(map.line_column_from_byte(offset));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * offsets.size());
+}
+BENCHMARK(BM_OffsetMapLookup)->ArgName("indexed")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// A keystroke in the middle of 10 MB: 0 rebuilds the map, 1 updates it
+static void BM_OffsetMapUpdate(benchmark::State& state) {
+    std::string text = accented_markdown();
+    TextOffsetMap map(text);
+    size_t offset = text.size() / 2;
+    bool inserted = false;
+    for (auto _ : state) {
+        // Alternately type a character and delete it again
+        if (inserted) {
+            text.erase(offset, 2);
+        } else {
+            text.insert(offset, "\u00E9");
+        }
+        if (state.range(0) == 0) {
+            map = TextOffsetMap(text);
+        } else {
+            map.update(text, offset, inserted ? 2 : 0, inserted ? 0 : 2);
+        }
+        inserted = !inserted;
+        benchmark::DoNotOptimize(map.utf16_length());
+    }
+}
+BENCHMARK(BM_OffsetMapUpdate)->ArgName("incremental")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
 static void BM_TOCGeneration(benchmark::State& state) {
     MarkdownParser parser;
     
@@ -185,6 +732,298 @@ static void BM_TOCGeneration(benchmark::State& state) {
 }
 BENCHMARK(BM_TOCGeneration);
 
+// About 10 MB of prose with a heading every ten paragraphs
+static const std::string& large_markdown() {
+    static const std::string markdown = generate_markdown(12000, 120);
+    return markdown;
+}
+
+static void BM_TOCGeneratorLarge(benchmark::State& state) {
+    const std::string& markdown = large_markdown();
+    TOCGenerator generator;
+    size_t headings = 0;
+    
+    for (auto _ : state) {
+        auto toc = generator.generate(markdown);
+        headings = toc.items.size();
+        benchmark::DoNotOptimize(toc);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.SetLabel("Headings: " + std::to_string(headings));
+}
+BENCHMARK(BM_TOCGeneratorLarge)->Unit(benchmark::kMillisecond);
+
+// The std::regex extraction TOCGenerator used to do, kept for comparison
+static void BM_TOCGeneratorRegexLarge(benchmark::State& state) {
+    const std::string& markdown = large_markdown();
+    size_t headings = 0;
+    
+    for (auto _ : state) {
+        std::vector<std::string> titles;
+        std::regex heading_regex(R"(^(#{1,6})\s+(.+)$)", std::regex::multiline);
+        for (auto it = std::sregex_iterator(markdown.begin(), markdown.end(), heading_regex);
+             it != std::sregex_iterator(); ++it) {
+            std::string title = (*it)[2].str();
+            title = std::regex_replace(title, std::regex(R"(\*\*|__)"), "");
+            title = std::regex_replace(title, std::regex(R"(\*|_)"), "");
+            title = std::regex_replace(title, std::regex("`"), "");
+            title = std::regex_replace(title, std::regex(R"(\[([^\]]+)\]\([^\)]+\))"), "$1");
+            titles.push_back(std::move(title));
+        }
+        headings = titles.size();
+        benchmark::DoNotOptimize(titles);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.SetLabel("Headings: " + std::to_string(headings));
+}
+BENCHMARK(BM_TOCGeneratorRegexLarge)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+// A file-watcher reload of a document with 3000 headings where one was
+// retitled and a section added, as the sidebar sees it
+static void BM_TOCDiff(benchmark::State& state) {
+    MarkdownParser parser;
+    auto outline = [](bool edited) {
+        std::stringstream ss;
+        for (int i = 0; i < 500; ++i) {
+            ss << "# Chapter " << i << "\n";
+            for (int j = 0; j < 5; ++j) {
+                ss << "## Section " << i << "." << j << (edited && i == 250 && j == 2 ? " (revised)" : "") << "\n";
+                ss << "Some content here.\n\n";
+            }
+            if (edited && i == 400) {
+                ss << "## Appendix\n";
+            }
+        }
+        return ss.str();
+    };
+    auto before = parser.parse(outline(false));
+    auto after = parser.parse(outline(true));
+    size_t changes = 0;
+    
+    for (auto _ : state) {
+        auto script = TOCDiff::compute(before->get_toc(), after->get_toc());
+        changes = script.changes.size();
+        benchmark::DoNotOptimize(script);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * 3000);
+    state.SetLabel("Changes: " + std::to_string(changes));
+}
+BENCHMARK(BM_TOCDiff)->Unit(benchmark::kMicrosecond);
+
+// Following a fragment link in a document with 3000 headings, by anchor
+// and by heading text
+static void BM_AnchorLookup(benchmark::State& state) {
+    MarkdownParser parser;
+    std::stringstream ss;
+    for (int i = 0; i < 500; ++i) {
+        ss << "# Chapter " << i << "\n";
+        for (int j = 0; j < 5; ++j) {
+            ss << "## Section " << i << "." << j << "\n";
+            ss << "Some content here.\n\n";
+        }
+    }
+    auto doc = parser.parse(ss.str());
+    size_t i = 0;
+    
+    for (auto _ : state) {
+        const auto* by_slug = doc->find_anchor("#section-250" + std::to_string(i % 5));
+        const auto* by_text = doc->find_anchor("Chapter " + std::to_string(i % 500));
+        benchmark::DoNotOptimize(by_slug);
+        benchmark::DoNotOptimize(by_text);
+        ++i;
+    }
+    
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_AnchorLookup);
+
+// Counting the links and text in a document of about 100k nodes, through
+// Document::visit (std::function, recursive), walk() and preorder()
+static void BM_Traversal(benchmark::State& state) {
+    MarkdownParser parser;
+    std::stringstream ss;
+    for (int i = 0; i < 5000; ++i) {
+        if (i % 20 == 0) {
+            ss << "## Section " << i / 20 << "\n\n";
+        }
+        ss << "Some *emphasis* and a [link " << i << "](page" << i << ".md) with **strong** text.\n\n";
+        if (i % 10 == 0) {
+            ss << "- one\n- two [more](more.md)\n\n";
+        }
+    }
+    auto doc = parser.parse(ss.str());
+    using Node = Document::Node;
+    using NodeType = Document::NodeType;
+    
+    for (auto _ : state) {
+        size_t links = 0;
+        size_t text = 0;
+        switch (state.range(0)) {
+            case 0:
+                doc->visit([&](const Node& node) {
+                    if (node.type == NodeType::Link) {
+                        ++links;
+                    } else if (node.type == NodeType::Text) {
+                        text += node.content.size();
+                    }
+                });
+                break;
+            case 1:
+                walk(*doc, Overloaded{
+                    [&](const Node&, NodeTag<NodeType::Link>) { ++links; },
+                    [&](const Node& node, NodeTag<NodeType::Text>) { text += node.content.size(); },
+                });
+                break;
+            default:
+                for (const auto& node : preorder(*doc)) {
+                    if (node.type == NodeType::Link) {
+                        ++links;
+                    } else if (node.type == NodeType::Text) {
+                        text += node.content.size();
+                    }
+                }
+                break;
+        }
+        benchmark::DoNotOptimize(links);
+        benchmark::DoNotOptimize(text);
+    }
+    
+    size_t nodes = 0;
+    walk(*doc, [&nodes](const Node&) { ++nodes; });
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+BENCHMARK(BM_Traversal)->ArgName("visit_walk_preorder")->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+// Finding the mermaid blocks and one section's links among 10k paragraphs,
+// by walking the tree and from the type index
+static void BM_TypedQuery(benchmark::State& state) {
+    MarkdownParser parser;
+    std::stringstream ss;
+    for (int i = 0; i < 10000; ++i) {
+        if (i % 100 == 0) {
+            ss << "# Part " << i / 100 << "\n\n";
+        }
+        ss << "Text with a [link " << i << "](page" << i << ".md) and *emphasis*.\n\n";
+        if (i % 500 == 0) {
+            ss << "```mermaid\ngraph TD\n```\n\n";
+        }
+    }
+    auto doc = parser.parse(ss.str());
+    const auto* anchor = doc->find_anchor("part-50");
+    doc->nodes_of_type(Document::NodeType::Link);
+    using Node = Document::Node;
+    using NodeType = Document::NodeType;
+    
+    for (auto _ : state) {
+        size_t mermaid = 0;
+        size_t links = 0;
+        if (state.range(0) == 0) {
+            walk(*doc, Overloaded{
+                [&](const Node& node, NodeTag<NodeType::CodeBlock>) {
+                    mermaid += node.code_language == "mermaid";
+                    return Visit::SkipChildren;
+                },
+                [&](const Node& node, NodeTag<NodeType::Link>) {
+                    links += node.source_start >= anchor->position && node.source_start < anchor->section_end;
+                },
+            });
+        } else {
+            mermaid = doc->code_blocks("mermaid").size();
+            links = doc->nodes_of_type(NodeType::Link, *anchor).size();
+        }
+        benchmark::DoNotOptimize(mermaid);
+        benchmark::DoNotOptimize(links);
+    }
+}
+BENCHMARK(BM_TypedQuery)->ArgName("indexed")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Generated worst cases at `scale` repetitions: 0 nested blockquotes,
+// 1 nested lists, 2 one emphasis run, 3 unmatched "[[" on one line, 4 one
+// long line of unclosed code spans and brackets, 5 one long line of "]:"
+// for the link definition check, 6 the same behind a deep container prefix,
+// 7 shortcut references each followed by a "(" that never closes
+static std::string adversarial_markdown(int64_t kind, size_t scale) {
+    auto repeat = [](std::string_view piece, size_t count) {
+        std::string out;
+        out.reserve(piece.size() * count);
+        for (size_t i = 0; i < count; ++i) {
+            out += piece;
+        }
+        return out;
+    };
+    switch (kind) {
+        case 0:
+            return "# " + repeat(">", scale) + " quoted\n";
+        case 1:
+            return "# " + repeat("- ", scale) + "item\n";
+        case 2:
+            return "# " + repeat("*", scale) + "emphasis" + repeat("*", scale) + "\n";
+        case 3:
+            return "# " + repeat("[[", scale) + "\n";
+        case 5:
+            return "# Title\n\n" + repeat("x]:", scale) + "\n";
+        case 6:
+            return repeat("> ", scale) + "x" + repeat("]:", scale) + "\n";
+        case 7:
+            return "[foo]: /url\n\n" + repeat("[foo]( ", scale) + "\n";
+        case 4:
+        default:
+            return "# " + repeat("`x [a](", scale) + "\n";
+    }
+}
+
+// Parses, walks, outlines, scans and streams (in 4 KB pieces) each worst
+// case at two sizes eight times apart, and fails unless the larger costs
+// less than 16 times as much: anything quadratic costs 64 times
+static void BM_AdversarialScaling(benchmark::State& state) {
+    constexpr size_t kSmall = 16 * 1024;
+    constexpr size_t kGrowth = 8;
+    const std::string small = adversarial_markdown(state.range(0), kSmall);
+    const std::string large = adversarial_markdown(state.range(0), kSmall * kGrowth);
+    MarkdownParser parser;
+    TOCGenerator generator;
+    std::vector<Document::Link> links;
+    
+    auto process = [&](const std::string& markdown) {
+        auto start = std::chrono::steady_clock::now();
+        auto doc = parser.parse(markdown);
+        size_t nodes = 0;
+        walk(*doc, [&nodes](const Document::Node&) { ++nodes; });
+        auto toc = generator.generate(markdown);
+        links.clear();
+        StructuralScanner::scan(markdown, links);
+        size_t streamed = 0;
+        StreamingParser stream(parser, [&streamed](const Document::Node&) { ++streamed; });
+        for (size_t pos = 0; pos < markdown.size(); pos += 4096) {
+            stream.feed(std::string_view(markdown).substr(pos, 4096));
+        }
+        stream.finish();
+        doc.reset();
+        benchmark::DoNotOptimize(streamed);
+        benchmark::DoNotOptimize(nodes);
+        benchmark::DoNotOptimize(toc);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    double small_seconds = 0;
+    double large_seconds = 0;
+    for (auto _ : state) {
+        small_seconds += process(small);
+        large_seconds += process(large);
+    }
+    
+    double growth = large_seconds / std::max(small_seconds, 1e-9);
+    state.counters["growth"] = growth;
+    state.SetBytesProcessed(state.iterations() * (small.size() + large.size()));
+    if (growth > 2.0 * kGrowth) {
+        state.SkipWithError("cost grows faster than the input");
+    }
+}
+BENCHMARK(BM_AdversarialScaling)->ArgName("kind")->DenseRange(0, 7)->Unit(benchmark::kMillisecond);
+
 static void BM_IncrementalParsing(benchmark::State& state) {
     MarkdownParser parser;
     std::string markdown = generate_markdown(50, 30);
@@ -204,6 +1043,32 @@ static void BM_IncrementalParsing(benchmark::State& state) {
 }
 BENCHMARK(BM_IncrementalParsing);
 
+static void BM_StreamingParse10MB(benchmark::State& state) {
+    MarkdownParser parser;
+    std::string markdown;
+    while (markdown.size() < 10 * 1024 * 1024) {
+        markdown += generate_markdown(100, 100);
+    }
+    
+    // Fed the way a file or pipe is read, in fixed-size pieces
+    const size_t piece = static_cast<size_t>(state.range(0));
+    size_t blocks = 0;
+    size_t max_buffered = 0;
+    for (auto _ : state) {
+        StreamingParser stream(parser, [&blocks](const Document::Node&) { ++blocks; });
+        for (size_t offset = 0; offset < markdown.size(); offset += piece) {
+            stream.feed(std::string_view(markdown).substr(offset, piece));
+            max_buffered = std::max(max_buffered, stream.buffered_bytes());
+        }
+        stream.finish();
+    }
+    
+    state.SetBytesProcessed(state.iterations() * markdown.size());
+    state.counters["blocks/parse"] = static_cast<double>(blocks) / state.iterations();
+    state.counters["max_buffered"] = static_cast<double>(max_buffered);
+}
+BENCHMARK(BM_StreamingParse10MB)->ArgName("piece")->Arg(4096)->Arg(64 * 1024)->Unit(benchmark::kMillisecond);
+
 static void BM_ParseWithTables(benchmark::State& state) {
     MarkdownParser parser;
     parser.enable_tables(true);
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include "core/block_scanner.h"
+#include "core/markdown_parser.h"
+#include "core/node_visitor.h"
+#include "core/streaming_parser.h"
+#include "core/structural_scanner.h"
+#include "core/toc_generator.h"
+#include <string>
+#include <vector>
+
+using namespace mdviewer;
+
+using NodeType = Document::NodeType;
+
+// Inputs as deep or as long as we could make them. Each has to finish
+// without running out of stack; bench_parser checks that they also scale
+// linearly.
+
+namespace {
+
+constexpr size_t kDepth = 100000;
+
+std::string repeat(std::string_view piece, size_t count) {
+    std::string out;
+    out.reserve(piece.size() * count);
+    for (size_t i = 0; i < count; ++i) {
+        out += piece;
+    }
+    return out;
+}
+
+// A chain of blockquotes `depth` deep, ending in one text node
+std::unique_ptr<Document> deep_document(size_t depth, bool arena) {
+    std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+    auto doc = arena ? std::make_unique<Document>(upstream) : std::make_unique<Document>();
+    Document::NodePtr root = doc->create_node(NodeType::BlockQuote);
+    Document::Node* parent = root.get();
+    for (size_t level = 1; level < depth; ++level) {
+        parent->children.push_back(doc->create_node(NodeType::BlockQuote));
+        parent = parent->children.back().get();
+    }
+    Document::NodePtr text = doc->create_node(NodeType::Text);
+    text->content = "deep";
+    parent->children.push_back(std::move(text));
+    doc->set_root(std::move(root));
+    return doc;
+}
+
+} // namespace
+
+TEST(AdversarialInputTest, DeepTreesAreWalkedIndexedAndFreed) {
+    // Built by hand, so the depth doesn't depend on the parser's own limits
+    for (bool arena : {false, true}) {
+        auto doc = deep_document(kDepth, arena);
+        
+        size_t quotes = 0;
+        std::string_view text;
+        walk(*doc, Overloaded{
+            [&](const Document::Node&, NodeTag<NodeType::BlockQuote>) { ++quotes; },
+            [&](const Document::Node& node, NodeTag<NodeType::Text>) { text = node.content; },
+        });
+        EXPECT_EQ(quotes, kDepth);
+        EXPECT_EQ(text, "deep");
+        
+        size_t visited = 0;
+        doc->visit([&](const Document::Node&) { ++visited; });
+        EXPECT_EQ(visited, kDepth + 1);
+        EXPECT_EQ(doc->nodes_of_type(NodeType::BlockQuote).size(), kDepth);
+        EXPECT_EQ(doc->stats().words, 1);
+        
+        // Freeing the tree is the part that used to recurse once per level
+        doc.reset();
+    }
+}
+
+TEST(AdversarialInputTest, DeeplyNestedMarkdownParses) {
+    MarkdownParser parser;
+    parser.enable_arena_allocation(false);
+    const std::vector<std::string> inputs = {
+        repeat(">", kDepth) + " quoted\n",
+        repeat("- ", kDepth) + "item\n",
+        repeat("*", kDepth) + "emphasis" + repeat("*", kDepth) + "\n",
+        repeat("[", kDepth) + "label" + repeat("](url)", kDepth) + "\n",
+    };
+    for (const std::string& markdown : inputs) {
+        auto doc = parser.parse(markdown);
+        ASSERT_NE(doc, nullptr);
+        size_t nodes = 0;
+        walk(*doc, [&nodes](const Document::Node&) { ++nodes; });
+        EXPECT_GT(nodes, 0);
+        doc.reset();
+    }
+}
+
+TEST(AdversarialInputTest, HeadingMarkupIsStrippedInOnePass) {
+    // A million unmatched "[[" and "[", and the same again nested
+    std::string unmatched = repeat("[[", 1000000);
+    EXPECT_EQ(TOCGenerator::strip_inline_markup(unmatched), unmatched);
+    std::string unclosed = repeat("[a](", 100000);
+    EXPECT_EQ(TOCGenerator::strip_inline_markup(unclosed), unclosed);
+    std::string nested = repeat("[a ", kDepth) + "label" + repeat("](url)", kDepth);
+    EXPECT_EQ(TOCGenerator::strip_inline_markup(nested), repeat("a ", kDepth) + "label");
+    EXPECT_EQ(TOCGenerator::strip_inline_markup(repeat("< ", 100000) + ">"), repeat("< ", 100000) + ">");
+    
+    // Backtick runs of every length, none of them closed
+    std::string runs;
+    for (size_t run = 1; runs.size() < 1000000; ++run) {
+        runs += std::string(run, '`') + 'x';
+    }
+    EXPECT_EQ(TOCGenerator::strip_inline_markup(runs), runs);
+    
+    TOCGenerator generator;
+    auto toc = generator.generate("# " + unmatched + "\n\n## " + repeat("*_", 500000) + "end\n");
+    ASSERT_EQ(toc.items.size(), 2);
+    EXPECT_EQ(toc.items[0].title, unmatched);
+    EXPECT_EQ(toc.items[1].title, "end");
+}
+
+TEST(AdversarialInputTest, LongLinesScanForLinks) {
+    // 10 MB lines of unmatched "[[", of code spans that never close, and
+    // of fence-like runs in the middle of a line
+    std::vector<Document::Link> links;
+    StructuralScanner::scan(repeat("[[", 5 * 1024 * 1024), links);
+    EXPECT_TRUE(links.empty());
+    
+    std::string runs;
+    for (size_t run = 1; runs.size() < 10 * 1024 * 1024; ++run) {
+        runs += std::string(run, '`') + " [[x ";
+    }
+    StructuralScanner::scan(runs + "[[target]]", links);
+    ASSERT_EQ(links.size(), 1);
+    EXPECT_EQ(links[0].url, "target");
+    
+    links.clear();
+    StructuralScanner::scan(repeat("```a", 2 * 1024 * 1024) + " [[target]]", links);
+    ASSERT_EQ(links.size(), 1);
+    EXPECT_EQ(links[0].url, "target");
+}
+
+TEST(AdversarialInputTest, LongLinesScanForLinkDefinitions) {
+    // Every parse checks for link definitions first. 10 MB of "]:" on one
+    // line, bare and behind a container prefix as long again, have to be
+    // read once rather than walked back over for every hit.
+    const std::string bare = repeat("x]:", 3 * 1024 * 1024);
+    const std::string prefixed = repeat("> ", 2 * 1024 * 1024) + "x" + repeat("]:", 2 * 1024 * 1024);
+    EXPECT_FALSE(BlockScanner::contains_link_definition(bare));
+    EXPECT_FALSE(BlockScanner::contains_link_definition(prefixed));
+    EXPECT_TRUE(BlockScanner::contains_link_definition(bare + "\n> - [label]: /url\n"));
+    EXPECT_TRUE(BlockScanner::contains_link_definition(repeat("> ", 1024 * 1024) + "[label" + repeat("]:", 1024 * 1024)));
+    
+    // Parsed, with the prefix as deep as the nesting tests go
+    MarkdownParser parser;
+    for (const std::string& markdown : {bare, repeat("> ", kDepth) + "x" + repeat("]:", 1024 * 1024)}) {
+        auto doc = parser.parse(markdown);
+        ASSERT_NE(doc, nullptr);
+        EXPECT_FALSE(doc->has_link_definitions());
+    }
+}
+
+TEST(AdversarialInputTest, LinksBeforeUnclosedOpenersParse) {
+    // Shortcut references followed by a "(" or "[" that never closes, on
+    // one line and a line each; a link's range must stop at its "]"
+    // rather than each one searching the rest of the document
+    MarkdownParser parser;
+    for (std::string_view piece : {"[foo]( ", "[foo][\n"}) {
+        auto doc = parser.parse("[foo]: /url\n\n" + repeat(piece, 200000));
+        ASSERT_NE(doc, nullptr);
+        auto links = doc->nodes_of_type(NodeType::Link);
+        ASSERT_FALSE(links.empty());
+        for (const auto& link : links) {
+            EXPECT_EQ(link.node->source_end - link.node->source_start, 5u);
+        }
+    }
+}
+
+TEST(AdversarialInputTest, LongLinesStreamInPieces) {
+    // A 10 MB line fed 4 KB at a time, then the same with a line break in
+    // every piece; each feed has to cost what it brings, not the buffer
+    MarkdownParser parser;
+    for (std::string_view text : {std::string_view("word "), std::string_view("word\nword ")}) {
+        size_t blocks = 0;
+        size_t bytes = 0;
+        StreamingParser stream(parser, [&](const Document::Node& block) {
+            ++blocks;
+            bytes = block.source_end;
+        });
+        const std::string line = repeat(text, 10 * 1024 * 1024 / text.size());
+        for (size_t pos = 0; pos < line.size(); pos += 4096) {
+            stream.feed(std::string_view(line).substr(pos, 4096));
+        }
+        stream.finish();
+        EXPECT_EQ(blocks, 1u);
+        EXPECT_GT(bytes, line.size() - 16);
+    }
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "core/document_cache.h"
+#include "core/markdown_parser.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace mdviewer;
+
+namespace {
+
+::testing::AssertionResult SameTree(const Document::Node& a, const Document::Node& b) {
+    if (a.type != b.type || a.content != b.content || a.heading_level != b.heading_level ||
+        a.code_language != b.code_language || a.link_url != b.link_url || a.image_alt != b.image_alt ||
+        a.list_ordered != b.list_ordered || a.list_start != b.list_start ||
+        a.source_start != b.source_start || a.source_end != b.source_end ||
+        a.children.size() != b.children.size()) {
+        return ::testing::AssertionFailure()
+            << "nodes differ at [" << a.source_start << ", " << a.source_end << "): \""
+            << a.content << "\" vs \"" << b.content << "\"";
+    }
+    for (size_t i = 0; i < a.children.size(); ++i) {
+        auto result = SameTree(*a.children[i], *b.children[i]);
+        if (!result) {
+            return result;
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+std::string read_bytes(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void write_bytes(const std::filesystem::path& path, const std::string& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << bytes;
+}
+
+} // namespace
+
+class DocumentCacheTest : public ::testing::Test {
+protected:
+    MarkdownParser parser;
+    std::filesystem::path directory;
+    std::filesystem::path entry;
+    std::string markdown =
+        "# Title\n\nSome *emphasis*, a [link](https://example.com) and &amp; an entity.\n\n"
+        "```cpp\nint main() {}\n```\n\n- one\n- two\n\n> quoted **text**\n\n## Second\n";
+
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+            ("inkwell_cache_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+             "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::create_directories(directory);
+        entry = directory / "entry.inkdoc";
+    }
+
+    void TearDown() override {
+        std::error_code ignored;
+        std::filesystem::remove_all(directory, ignored);
+    }
+};
+
+TEST_F(DocumentCacheTest, RoundTripMatchesParse) {
+    auto parsed = parser.parse(markdown);
+    ASSERT_TRUE(DocumentCache::write_entry(entry, *parsed, parser.options_key()));
+
+    auto loaded = DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(SameTree(*loaded->get_root(), *parsed->get_root()));
+    EXPECT_EQ(loaded->source(), markdown);
+    EXPECT_EQ(loaded->get_toc().entries.size(), parsed->get_toc().entries.size());
+    EXPECT_EQ(loaded->word_count(), parsed->word_count());
+    EXPECT_EQ(loaded->has_link_definitions(), parsed->has_link_definitions());
+}
+
+TEST_F(DocumentCacheTest, LoadedTextViewsTheSource) {
+    auto owner = std::make_shared<const std::string>(markdown);
+    auto parsed = parser.parse(*owner, owner);
+    ASSERT_TRUE(DocumentCache::write_entry(entry, *parsed, parser.options_key()));
+
+    auto loaded = DocumentCache::read_entry(entry, *owner, owner, parser.options_key());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->source().data(), owner->data());
+
+    const Document::Node* text = loaded->node_at_offset(owner->find("Some"));
+    ASSERT_NE(text, nullptr);
+    EXPECT_EQ(text->content.data(), owner->data() + owner->find("Some"));
+}
+
+TEST_F(DocumentCacheTest, RejectsDifferentSourceOrOptions) {
+    auto parsed = parser.parse(markdown);
+    ASSERT_TRUE(DocumentCache::write_entry(entry, *parsed, parser.options_key()));
+
+    std::string edited = markdown;
+    edited[2] = 't';
+    EXPECT_EQ(DocumentCache::read_entry(entry, edited, nullptr, parser.options_key()), nullptr);
+    EXPECT_EQ(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key() ^ 1), nullptr);
+    EXPECT_EQ(DocumentCache::read_entry(directory / "missing.inkdoc", markdown, nullptr, parser.options_key()), nullptr);
+}
+
+TEST_F(DocumentCacheTest, DetectsCorruptEntries) {
+    auto parsed = parser.parse(markdown);
+    ASSERT_TRUE(DocumentCache::write_entry(entry, *parsed, parser.options_key()));
+    const std::string original = read_bytes(entry);
+    ASSERT_GT(original.size(), 72u);
+
+    // Every single-byte flip, in the header or the payload, is a miss
+    for (size_t i = 0; i < original.size(); ++i) {
+        std::string damaged = original;
+        damaged[i] ^= 0x40;
+        write_bytes(entry, damaged);
+        EXPECT_EQ(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key()), nullptr) << "byte " << i;
+    }
+
+    write_bytes(entry, original.substr(0, original.size() - 1));
+    EXPECT_EQ(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key()), nullptr);
+    write_bytes(entry, "");
+    EXPECT_EQ(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key()), nullptr);
+
+    write_bytes(entry, original);
+    EXPECT_NE(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key()), nullptr);
+}
+
+TEST_F(DocumentCacheTest, RejectsChildCountsPastTheTable) {
+    auto parsed = parser.parse(markdown);
+    ASSERT_TRUE(DocumentCache::write_entry(entry, *parsed, parser.options_key()));
+    std::string bytes = read_bytes(entry);
+
+    // The root record's child_count, with the checksum redone so that only
+    // the count gives the entry away
+    constexpr size_t kHeaderSize = 72;
+    constexpr size_t kChecksumOffset = 64;
+    const uint32_t huge = 0xFFFFFFFF;
+    std::memcpy(bytes.data() + kHeaderSize + 8, &huge, sizeof(huge));
+    std::string header = bytes.substr(0, kHeaderSize);
+    std::fill(header.begin() + kChecksumOffset, header.end(), '\0');
+    const uint64_t checksum = DocumentCache::hash(std::string_view(bytes).substr(kHeaderSize), DocumentCache::hash(header));
+    std::memcpy(bytes.data() + kChecksumOffset, &checksum, sizeof(checksum));
+    write_bytes(entry, bytes);
+
+    EXPECT_EQ(DocumentCache::read_entry(entry, markdown, nullptr, parser.options_key()), nullptr);
+}
+
+TEST_F(DocumentCacheTest, StoresUnderTheUserCacheDirectory) {
+    const char* previous_home = std::getenv("HOME");
+    std::string saved_home = previous_home ? previous_home : "";
+    setenv("HOME", directory.c_str(), 1);
+
+    auto markdown_path = directory / "notes.md";
+    auto parsed = parser.parse(markdown);
+    EXPECT_TRUE(DocumentCache::store(markdown_path, *parsed, parser.options_key()));
+    EXPECT_EQ(DocumentCache::entry_path(markdown_path).parent_path().parent_path(),
+              directory / "Library" / "Caches" / "Inkwell");
+    EXPECT_TRUE(std::filesystem::exists(DocumentCache::entry_path(markdown_path)));
+    EXPECT_NE(DocumentCache::entry_path(markdown_path), DocumentCache::entry_path(directory / "other.md"));
+
+    auto loaded = DocumentCache::load(markdown_path, markdown, nullptr, parser.options_key());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(SameTree(*loaded->get_root(), *parsed->get_root()));
+
+    if (previous_home) {
+        setenv("HOME", saved_home.c_str(), 1);
+    } else {
+        unsetenv("HOME");
+    }
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "core/frontmatter.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace mdviewer;
+
+TEST(FrontmatterTest, SplitsFencedBlockWithoutCopying) {
+    std::string text = "---\ntitle: Notes\n---\n# Heading\n";
+    auto frontmatter = Frontmatter::split(text);
+    
+    ASSERT_TRUE(frontmatter.present());
+    EXPECT_EQ(frontmatter.yaml(), "title: Notes\n");
+    EXPECT_EQ(frontmatter.body(), "# Heading\n");
+    EXPECT_EQ(frontmatter.body_offset(), text.find('#'));
+    EXPECT_EQ(frontmatter.body().data(), text.data() + text.find('#'));
+}
+
+TEST(FrontmatterTest, AcceptsCrlfBomAndDocumentEndMarker) {
+    auto crlf = Frontmatter::split("---\r\ntitle: A\r\n---\r\nBody");
+    ASSERT_TRUE(crlf.present());
+    EXPECT_EQ(crlf.get("title"), "A");
+    EXPECT_EQ(crlf.body(), "Body");
+    
+    auto bom = Frontmatter::split("\xEF\xBB\xBF---\ntitle: B\n...\nBody");
+    ASSERT_TRUE(bom.present());
+    EXPECT_EQ(bom.get("title"), "B");
+    EXPECT_EQ(bom.body(), "Body");
+    
+    auto at_end = Frontmatter::split("---\ntitle: C\n---");
+    ASSERT_TRUE(at_end.present());
+    EXPECT_TRUE(at_end.body().empty());
+}
+
+TEST(FrontmatterTest, NoFrontmatterLeavesTextAsBody) {
+    for (std::string_view text : {"# Just markdown\n", "---\nnever closed\n", "--- \n", "----\na: b\n----\n", ""}) {
+        auto frontmatter = Frontmatter::split(text);
+        EXPECT_FALSE(frontmatter.present()) << text;
+        EXPECT_EQ(frontmatter.body(), text);
+        EXPECT_TRUE(frontmatter.entries().empty());
+    }
+}
+
+TEST(FrontmatterTest, ParsesScalarsAndLists) {
+    std::string text =
+        "---\n"
+        "title: \"Quarterly: review\"\n"
+        "date: 2024-03-01  # planned\n"
+        "tags: [work, 'a, b', \"c\"]\n"
+        "aliases:\n"
+        "  - first\n"
+        "  - 'second'\n"
+        "summary: |\n"
+        "  Line one\n"
+        "\n"
+        "  Line two\n"
+        "# a comment\n"
+        "draft: false\n"
+        "---\n";
+    auto frontmatter = Frontmatter::split(text);
+    
+    EXPECT_EQ(frontmatter.get("title"), "Quarterly: review");
+    EXPECT_EQ(frontmatter.get("date"), "2024-03-01");
+    EXPECT_EQ(frontmatter.get_list("tags"), (std::vector<std::string_view>{"work", "a, b", "c"}));
+    EXPECT_EQ(frontmatter.get_list("aliases"), (std::vector<std::string_view>{"first", "second"}));
+    EXPECT_EQ(frontmatter.get("summary"), "  Line one\n\n  Line two");
+    EXPECT_EQ(frontmatter.get("draft"), "false");
+    EXPECT_EQ(frontmatter.get_list("draft"), std::vector<std::string_view>{"false"});
+    EXPECT_FALSE(frontmatter.get("missing").has_value());
+    EXPECT_EQ(frontmatter.entries().size(), 6);
+    
+    // Values view the original text
+    auto title = frontmatter.get("title");
+    EXPECT_GE(title->data(), text.data());
+    EXPECT_LT(title->data(), text.data() + text.size());
+}
+
+TEST(FrontmatterTest, ReadHeaderStopsAtByteLimit) {
+    auto path = std::filesystem::temp_directory_path() / "inkwell_frontmatter_test.md";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "---\ntitle: Big note\ntags: [a]\n---\n" << std::string(1 << 20, 'x');
+    }
+    
+    auto header = Frontmatter::read_header(path, 256);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_TRUE(header->present());
+    EXPECT_EQ(header->get("title"), "Big note");
+    EXPECT_LE(header->body_offset() + header->body().size(), 256);
+    
+    // Views stay valid in copies
+    Frontmatter copy = *header;
+    header.reset();
+    EXPECT_EQ(copy.get_list("tags"), std::vector<std::string_view>{"a"});
+    
+    auto truncated = Frontmatter::read_header(path, 8);
+    ASSERT_TRUE(truncated.has_value());
+    EXPECT_FALSE(truncated->present());
+    
+    std::filesystem::remove(path);
+    EXPECT_FALSE(Frontmatter::read_header(path).has_value());
+}
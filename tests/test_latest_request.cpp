@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "core/latest_request.h"
+#include "core/markdown_parser.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <string>
+#include <thread>
+
+using namespace mdviewer;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::string large_markdown() {
+    std::string markdown;
+    for (int i = 0; i < 40000; ++i) {
+        if (i % 50 == 0) {
+            markdown += "## Section " + std::to_string(i / 50) + "\n\n";
+        }
+        markdown += "Paragraph " + std::to_string(i) + " with *some* text and a [link](page.md).\n\n";
+    }
+    return markdown;
+}
+
+} // namespace
+
+TEST(LatestRequestTest, NewerRequestsMakeOlderOnesStale) {
+    LatestRequest latest;
+    uint64_t first = latest.supersede();
+    auto first_token = latest.start(first);
+    ASSERT_TRUE(first_token.has_value());
+    EXPECT_FALSE(first_token->cancelled());
+    
+    uint64_t second = latest.supersede();
+    EXPECT_TRUE(first_token->cancelled());
+    EXPECT_FALSE(latest.is_current(first));
+    EXPECT_FALSE(latest.start(first).has_value());
+    
+    auto second_token = latest.start(second);
+    ASSERT_TRUE(second_token.has_value());
+    EXPECT_FALSE(second_token->cancelled());
+    EXPECT_TRUE(latest.is_current(second));
+}
+
+// A file watcher thread reports 20 saves in quick succession while another
+// thread reloads them one by one, as the viewer does
+TEST(LatestRequestTest, BurstOfSavesCostsAboutOneParse) {
+    MarkdownParser parser;
+    const std::string markdown = large_markdown();
+    
+    auto one_parse = Clock::duration::max();
+    for (int i = 0; i < 3; ++i) {
+        auto start = Clock::now();
+        parser.parse(markdown);
+        one_parse = std::min(one_parse, Clock::now() - start);
+    }
+    
+    LatestRequest latest;
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::deque<uint64_t> reloads;
+    bool saving = true;
+    
+    std::thread watcher([&] {
+        for (int i = 0; i < 20; ++i) {
+            uint64_t ticket = latest.supersede();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                reloads.push_back(ticket);
+            }
+            queued.notify_one();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        saving = false;
+        queued.notify_one();
+    });
+    
+    size_t started = 0;
+    size_t completed = 0;
+    Clock::duration parsing{};
+    std::unique_ptr<Document> shown;
+    for (;;) {
+        uint64_t ticket;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queued.wait(lock, [&] { return !reloads.empty() || !saving; });
+            if (reloads.empty()) {
+                break;
+            }
+            ticket = reloads.front();
+            reloads.pop_front();
+        }
+        
+        auto token = latest.start(ticket);
+        if (!token) {
+            continue;
+        }
+        ++started;
+        auto start = Clock::now();
+        auto result = parser.parse(markdown, nullptr, {*token, std::nullopt});
+        parsing += Clock::now() - start;
+        if (result.complete()) {
+            ++completed;
+            shown = std::move(result.document);
+        }
+    }
+    watcher.join();
+    
+    // The last save is always parsed through; the rest stop early or never start
+    ASSERT_NE(shown, nullptr);
+    EXPECT_EQ(shown->source(), markdown);
+    EXPECT_GE(completed, 1);
+    EXPECT_LT(started, 20);
+    EXPECT_LT(parsing, one_parse * 3) << "one parse: "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(one_parse).count() << " ms";
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "core/mapped_file.h"
+#include "core/markdown_parser.h"
+#include "utils/file_utils.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace mdviewer;
+
+class MappedFileTest : public ::testing::Test {
+protected:
+    std::filesystem::path directory;
+
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+            ("inkwell_mapped_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+             "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::error_code ignored;
+        std::filesystem::remove_all(directory, ignored);
+    }
+
+    std::filesystem::path write(const std::string& name, const std::string& bytes) {
+        auto path = directory / name;
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << bytes;
+        return path;
+    }
+};
+
+TEST_F(MappedFileTest, SmallFilesAreRead) {
+    auto file = MappedFile::open(write("small.md", "# Title\n\nBody text.\n"));
+    ASSERT_NE(file, nullptr);
+    EXPECT_FALSE(file->mapped());
+    EXPECT_EQ(file->bytes(), "# Title\n\nBody text.\n");
+}
+
+TEST_F(MappedFileTest, LargeFilesAreMapped) {
+    std::string markdown;
+    for (int i = 0; markdown.size() < 4 * MappedFile::map_threshold; ++i) {
+        markdown += "## Section " + std::to_string(i) + "\n\nSome *text* and a [[link]].\n\n";
+    }
+    auto file = MappedFile::open(write("large.md", markdown));
+    ASSERT_NE(file, nullptr);
+    EXPECT_TRUE(file->mapped());
+    EXPECT_EQ(file->bytes(), markdown);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(file->bytes().data()) % 16, 0u);
+    EXPECT_EQ(FileUtils::read_file(directory / "large.md"), markdown);
+}
+
+TEST_F(MappedFileTest, EmptyAndSpecialFiles) {
+    auto empty = MappedFile::open(write("empty.md", ""));
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->bytes().empty());
+
+    // Not a regular file, so read until end of file rather than by size
+    auto device = MappedFile::open("/dev/null");
+    ASSERT_NE(device, nullptr);
+    EXPECT_TRUE(device->bytes().empty());
+}
+
+TEST_F(MappedFileTest, FailuresSayWhy) {
+    std::error_code error;
+    EXPECT_EQ(MappedFile::open(directory / "missing.md", error), nullptr);
+    EXPECT_EQ(error, std::errc::no_such_file_or_directory);
+
+    EXPECT_EQ(MappedFile::open(directory, error), nullptr);
+    EXPECT_EQ(error, std::errc::is_a_directory);
+}
+
+TEST_F(MappedFileTest, DocumentKeepsTheMappingAlive) {
+    std::string markdown;
+    for (int i = 0; markdown.size() < 2 * MappedFile::map_threshold; ++i) {
+        markdown += "Paragraph " + std::to_string(i) + " with some words.\n\n";
+    }
+    auto file = MappedFile::open(write("owned.md", markdown));
+    ASSERT_NE(file, nullptr);
+    std::string_view bytes = file->bytes();
+
+    MarkdownParser parser;
+    auto doc = parser.parse(bytes, file);
+    file.reset();
+
+    // Text nodes view the mapping, which the Document still holds
+    EXPECT_EQ(doc->source().data(), bytes.data());
+    EXPECT_EQ(doc->source(), markdown);
+    EXPECT_EQ(doc->get_root()->children.front()->children.front()->content, "Paragraph 0 with some words.");
+}
+
+TEST_F(MappedFileTest, ReadCopiesKeepTheirBytesWhenTheFileIsRewritten) {
+    std::string markdown;
+    for (int i = 0; markdown.size() < 2 * MappedFile::map_threshold; ++i) {
+        markdown += "Paragraph " + std::to_string(i) + " with some words.\n\n";
+    }
+    auto path = write("rewritten.md", markdown);
+    std::error_code error;
+    auto copy = MappedFile::read(path, error);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_FALSE(copy->mapped());
+    EXPECT_EQ(copy->bytes(), markdown);
+    auto mapping = MappedFile::open(path);
+    ASSERT_NE(mapping, nullptr);
+    EXPECT_TRUE(mapping->mapped());
+
+    // Rewritten in place, as some editors save, and then truncated and
+    // written again, which leaves the mapping's later pages behind
+    std::string edited = markdown;
+    edited.replace(0, 11, "Changed one");
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.write(edited.data(), static_cast<std::streamsize>(edited.size()));
+    }
+    EXPECT_EQ(copy->bytes(), markdown);
+    auto reloaded = MappedFile::read(path, error);
+    ASSERT_NE(reloaded, nullptr);
+    auto edit = MarkdownParser::Edit::between(copy->bytes(), reloaded->bytes());
+    EXPECT_EQ(edit.offset, 0u);
+    EXPECT_EQ(edit.inserted_text, "Changed one");
+
+    write("rewritten.md", "Short now.\n");
+    EXPECT_EQ(copy->bytes(), markdown);
+    EXPECT_EQ(MappedFile::read(path, error)->bytes(), "Short now.\n");
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "core/node_visitor.h"
+#include "core/markdown_parser.h"
+#include <string>
+#include <vector>
+
+using namespace mdviewer;
+
+using NodeType = Document::NodeType;
+
+class NodeVisitorTest : public ::testing::Test {
+protected:
+    MarkdownParser parser;
+    std::unique_ptr<Document> doc;
+    
+    void SetUp() override {
+        doc = parser.parse("# Title with [a link](https://example.com)\n\n"
+                           "Some *emphasis* and **strong** text.\n\n"
+                           "- item [one](one.md)\n- item two\n\n"
+                           "```cpp\nint x;\n```\n\n"
+                           "## Closing\n\nLast [link](#title).\n");
+        ASSERT_NE(doc, nullptr);
+    }
+};
+
+TEST_F(NodeVisitorTest, WalksInTheSameOrderAsVisit) {
+    std::vector<const Document::Node*> expected;
+    doc->visit([&](const Document::Node& node) { expected.push_back(&node); });
+    
+    std::vector<const Document::Node*> walked;
+    EXPECT_TRUE(walk(*doc, [&](const Document::Node& node) { walked.push_back(&node); }));
+    EXPECT_EQ(walked, expected);
+    
+    std::vector<const Document::Node*> iterated;
+    for (const auto& node : preorder(*doc)) {
+        iterated.push_back(&node);
+    }
+    EXPECT_EQ(iterated, expected);
+    EXPECT_GT(expected.size(), 10);
+}
+
+TEST_F(NodeVisitorTest, DispatchesOnNodeType) {
+    std::vector<std::string> urls;
+    size_t headings = 0;
+    size_t others = 0;
+    walk(*doc, Overloaded{
+        [&](const Document::Node& node, NodeTag<NodeType::Link>) { urls.emplace_back(node.link_url); },
+        [&](const Document::Node& node, NodeTag<NodeType::Heading> tag) {
+            EXPECT_EQ(tag.type, NodeType::Heading);
+            EXPECT_EQ(node.type, NodeType::Heading);
+            ++headings;
+        },
+        [&](const Document::Node& node) {
+            EXPECT_NE(node.type, NodeType::Link);
+            EXPECT_NE(node.type, NodeType::Heading);
+            ++others;
+        },
+    });
+    
+    EXPECT_EQ(urls, (std::vector<std::string>{"https://example.com", "one.md", "#title"}));
+    EXPECT_EQ(headings, 2);
+    EXPECT_GT(others, 0);
+}
+
+TEST_F(NodeVisitorTest, SkipsSubtreesAndStops) {
+    // Skipping headings leaves out the link inside the title
+    std::vector<std::string> urls;
+    walk(*doc, Overloaded{
+        [](const Document::Node&, NodeTag<NodeType::Heading>) { return Visit::SkipChildren; },
+        [&](const Document::Node& node, NodeTag<NodeType::Link>) { urls.emplace_back(node.link_url); },
+    });
+    EXPECT_EQ(urls, (std::vector<std::string>{"one.md", "#title"}));
+    
+    // Stopping at the first code block
+    size_t visited = 0;
+    bool finished = walk(*doc, [&](const Document::Node& node) {
+        ++visited;
+        return node.type == NodeType::CodeBlock ? Visit::Stop : Visit::Continue;
+    });
+    EXPECT_FALSE(finished);
+    size_t before_code = 0;
+    for (const auto& node : preorder(*doc)) {
+        ++before_code;
+        if (node.type == NodeType::CodeBlock) {
+            break;
+        }
+    }
+    EXPECT_EQ(visited, before_code);
+}
+
+TEST_F(NodeVisitorTest, IteratorSkipsChildren) {
+    std::vector<NodeType> types;
+    auto range = preorder(*doc);
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        types.push_back(it->type);
+        bool block = it->type == NodeType::Paragraph && &*it != doc->get_root();
+        if (block || it->type == NodeType::List || it->type == NodeType::Heading) {
+            it.skip_children();
+        }
+    }
+    
+    for (NodeType type : types) {
+        EXPECT_NE(type, NodeType::ListItem);
+        EXPECT_NE(type, NodeType::Link);
+    }
+    EXPECT_NE(std::find(types.begin(), types.end(), NodeType::CodeBlock), types.end());
+    
+    // An empty tree has nothing to visit
+    EXPECT_EQ(preorder(static_cast<const Document::Node*>(nullptr)).begin(), std::default_sentinel);
+    EXPECT_TRUE(walk(static_cast<const Document::Node*>(nullptr), [](const Document::Node&) {}));
+}
@@ -1,9 +1,50 @@
 #include <gtest/gtest.h>
 #include "core/markdown_parser.h"
+#include "core/streaming_parser.h"
 #include "core/document.h"
+#include <random>
+#include <thread>
 
 using namespace mdviewer;
 
+namespace {
+
+// Compares two trees node by node, including source ranges
+::testing::AssertionResult SameTree(const Document::Node& a, const Document::Node& b) {
+    if (a.type != b.type || a.content != b.content || a.heading_level != b.heading_level ||
+        a.code_language != b.code_language || a.link_url != b.link_url ||
+        a.list_ordered != b.list_ordered || a.list_start != b.list_start ||
+        a.source_start != b.source_start || a.source_end != b.source_end ||
+        a.children.size() != b.children.size()) {
+        return ::testing::AssertionFailure()
+            << "nodes differ at [" << a.source_start << ", " << a.source_end << ") vs ["
+            << b.source_start << ", " << b.source_end << "): \"" << a.content << "\" vs \"" << b.content << "\"";
+    }
+    for (size_t i = 0; i < a.children.size(); ++i) {
+        auto result = SameTree(*a.children[i], *b.children[i]);
+        if (!result) {
+            return result;
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+::testing::AssertionResult ReparseMatchesFullParse(MarkdownParser& parser, const std::string& before,
+                                                   const MarkdownParser::Edit& edit) {
+    auto doc = parser.parse(before);
+    std::string after = before;
+    after.replace(edit.offset, edit.removed_len, edit.inserted_text);
+    if (!parser.reparse(*doc, edit)) {
+        return ::testing::AssertionFailure() << "reparse rejected the edit";
+    }
+    if (doc->source() != after) {
+        return ::testing::AssertionFailure() << "source not updated";
+    }
+    return SameTree(*doc->get_root(), *parser.parse(after)->get_root());
+}
+
+} // namespace
+
 class MarkdownParserTest : public ::testing::Test {
 protected:
     std::unique_ptr<MarkdownParser> parser;
@@ -144,7 +185,7 @@ TEST_F(MarkdownParserTest, ParseTable) {
 | Cell 1   | Cell 2   |
 | Cell 3   | Cell 4   |
 )";
-    
+
     parser->enable_tables(true);
     auto doc = parser->parse(markdown);
     
@@ -234,7 +275,7 @@ TEST_F(MarkdownParserTest, TableOfContentsGeneration) {
 # Chapter 2
 ## Section 2.1
 )";
-    
+
     auto doc = parser->parse(markdown);
     ASSERT_NE(doc, nullptr);
     
@@ -244,6 +285,50 @@ TEST_F(MarkdownParserTest, TableOfContentsGeneration) {
     EXPECT_EQ(toc.entries[0].children[0].children.size(), 1); // One subsection
 }
 
+TEST_F(MarkdownParserTest, TableOfContentsEntriesHaveTextAndPositions) {
+    std::string markdown = "# The **first** one\n\n### Skips a level\n\n## `code` heading\n";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto& entries = doc->get_toc().entries;
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].text, "The first one");
+    EXPECT_EQ(entries[0].position, 0);
+    ASSERT_EQ(entries[0].children.size(), 2);
+    EXPECT_EQ(entries[0].children[0].text, "Skips a level");
+    EXPECT_EQ(entries[0].children[1].text, "code heading");
+    EXPECT_EQ(entries[0].children[1].position, markdown.find("## `"));
+}
+
+TEST_F(MarkdownParserTest, HeadingAnchorsResolveToSections) {
+    std::string markdown = "# Guide\n\nIntro.\n\n## Set up\n\nSteps.\n\n### Notes\n\nMore.\n\n"
+                           "## Set up\n\nAgain.\n\n# Reference\n\nEnd.\n";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto& entries = doc->get_toc().entries;
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_EQ(entries[0].children.size(), 2);
+    EXPECT_EQ(entries[0].children[0].slug, "set-up");
+    EXPECT_EQ(entries[0].children[1].slug, "set-up-1");
+    
+    const auto* anchor = doc->find_anchor("#set-up");
+    ASSERT_NE(anchor, nullptr);
+    EXPECT_EQ(anchor->position, markdown.find("## Set up"));
+    EXPECT_EQ(doc->section_source(*anchor), "## Set up\n\nSteps.\n\n### Notes\n\nMore.\n\n");
+    
+    // The last heading's section runs to the end
+    anchor = doc->find_anchor("reference");
+    ASSERT_NE(anchor, nullptr);
+    EXPECT_EQ(doc->section_source(*anchor), "# Reference\n\nEnd.\n");
+    
+    // Heading text, as wikilinks write it, and percent-encoding resolve too
+    EXPECT_EQ(doc->find_anchor("Notes"), doc->find_anchor("#notes"));
+    EXPECT_NE(doc->find_anchor("Notes"), nullptr);
+    EXPECT_EQ(doc->find_anchor("set%2Dup-1")->position, markdown.rfind("## Set up"));
+    EXPECT_EQ(doc->find_anchor("#missing"), nullptr);
+}
+
 TEST_F(MarkdownParserTest, ParseEmptyDocument) {
     std::string markdown = "";
     auto doc = parser->parse(markdown);
@@ -295,4 +380,640 @@ TEST_F(MarkdownParserTest, IncrementalParsing) {
     });
     
     EXPECT_GT(callback_count, 0);
-}
\ No newline at end of file
+}
+TEST_F(MarkdownParserTest, ArenaAllocationUsesProvidedResource) {
+    // Tracks how many bytes the parser pulls from its upstream resource
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        size_t bytes = 0;
+    private:
+        void* do_allocate(size_t size, size_t align) override {
+            bytes += size;
+            return std::pmr::new_delete_resource()->allocate(size, align);
+        }
+        void do_deallocate(void* ptr, size_t size, size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(ptr, size, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+    
+    CountingResource resource;
+    std::string markdown = "# Title\n\nSome *emphasis* and a [link](https://example.com).\n\n- one\n- two";
+    auto doc = parser->parse(markdown, &resource);
+    
+    ASSERT_NE(doc, nullptr);
+    EXPECT_TRUE(doc->uses_arena());
+    EXPECT_GT(resource.bytes, 0u);
+    
+    size_t node_count = 0;
+    doc->visit([&node_count](const Document::Node& node) {
+        EXPECT_TRUE(node.arena_allocated);
+        node_count++;
+    });
+    EXPECT_GT(node_count, 5u);
+}
+
+TEST_F(MarkdownParserTest, HeapAllocationWhenArenaDisabled) {
+    parser->enable_arena_allocation(false);
+    auto doc = parser->parse("Plain *text*");
+    
+    ASSERT_NE(doc, nullptr);
+    EXPECT_FALSE(doc->uses_arena());
+    doc->visit([](const Document::Node& node) {
+        EXPECT_FALSE(node.arena_allocated);
+    });
+    EXPECT_EQ(doc->word_count(), 2);
+}
+
+TEST_F(MarkdownParserTest, SoftWrappedLinesCoalesceIntoOneTextNode) {
+    std::string markdown = "First line\nsecond line\nthird line";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto* paragraph = doc->get_root()->children[0].get();
+    ASSERT_EQ(paragraph->children.size(), 1);
+    
+    // The merged text is a view into the Document's copy of the source
+    std::string_view text = paragraph->children[0]->content;
+    EXPECT_EQ(text, "First line\nsecond line\nthird line");
+    EXPECT_GE(text.data(), doc->source().data());
+    EXPECT_LE(text.data() + text.size(), doc->source().data() + doc->source().size());
+}
+
+TEST_F(MarkdownParserTest, CodeBlockTextIsSingleNode) {
+    std::string markdown = "```cpp\nint main() {\n    return 0;\n}\n```";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto* code = doc->get_root()->children[0].get();
+    ASSERT_EQ(code->type, Document::NodeType::CodeBlock);
+    ASSERT_EQ(code->children.size(), 1);
+    EXPECT_EQ(code->children[0]->content, "int main() {\n    return 0;\n}\n");
+}
+
+TEST_F(MarkdownParserTest, ZeroCopyParseKeepsOwnerAlive) {
+    auto buffer = std::make_shared<std::string>("# Title\n\nBody text");
+    std::weak_ptr<std::string> weak = buffer;
+    
+    auto doc = parser->parse(*buffer, buffer);
+    EXPECT_EQ(doc->source().data(), buffer->data());
+    
+    buffer.reset();
+    EXPECT_FALSE(weak.expired());
+    EXPECT_EQ(doc->word_count(), 3);
+    
+    doc.reset();
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST_F(MarkdownParserTest, EntitiesAreDecodedIntoText) {
+    auto doc = parser->parse("Fish &amp; chips");
+    
+    ASSERT_NE(doc, nullptr);
+    const auto* paragraph = doc->get_root()->children[0].get();
+    ASSERT_EQ(paragraph->children.size(), 1);
+    EXPECT_EQ(paragraph->children[0]->content, "Fish & chips");
+}
+
+TEST_F(MarkdownParserTest, NodesRecordSourceRanges) {
+    std::string markdown = "# Title\n\nSome *emphasis* and [a link](http://x.io).\n\n```js\nx();\n```\n";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto& blocks = doc->get_root()->children;
+    ASSERT_EQ(blocks.size(), 3);
+    auto text_of = [&](const Document::Node* node) {
+        return std::string_view(markdown).substr(node->source_start, node->source_end - node->source_start);
+    };
+    
+    EXPECT_EQ(text_of(blocks[0].get()), "# Title");
+    EXPECT_EQ(text_of(blocks[1].get()), "Some *emphasis* and [a link](http://x.io).");
+    EXPECT_EQ(text_of(blocks[2].get()), "```js\nx();\n```");
+    
+    const auto& spans = blocks[1]->children;
+    ASSERT_GE(spans.size(), 4);
+    EXPECT_EQ(text_of(spans[1].get()), "*emphasis*");
+    EXPECT_EQ(text_of(spans[3].get()), "[a link](http://x.io)");
+    
+    auto links = doc->extract_links();
+    ASSERT_EQ(links.size(), 1);
+    EXPECT_EQ(links[0].position, markdown.find("[a link]"));
+}
+
+TEST_F(MarkdownParserTest, NodeAtOffsetFindsInnermostNode) {
+    std::string markdown = "Intro\n\n> Quoted **bold** words\n";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto* bold_text = doc->node_at_offset(markdown.find("bold"));
+    ASSERT_NE(bold_text, nullptr);
+    EXPECT_EQ(bold_text->type, Document::NodeType::Text);
+    EXPECT_EQ(bold_text->content, "bold");
+    
+    const auto* marker = doc->node_at_offset(markdown.find("**"));
+    ASSERT_NE(marker, nullptr);
+    EXPECT_EQ(marker->type, Document::NodeType::Strong);
+    
+    // The blank line between blocks belongs only to the root
+    EXPECT_EQ(doc->node_at_offset(6), doc->get_root());
+    EXPECT_EQ(doc->node_at_offset(markdown.size()), nullptr);
+}
+
+TEST_F(MarkdownParserTest, NodesInRangeReturnsOverlapsInDocumentOrder) {
+    std::string markdown = "# One\n\nFirst paragraph\n\n# Two\n\nSecond paragraph\n";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    size_t begin = markdown.find("paragraph");
+    size_t end = markdown.find("Two") + 1;
+    auto nodes = doc->nodes_in_range(begin, end);
+    
+    const auto& blocks = doc->get_root()->children;
+    ASSERT_EQ(nodes.size(), 5);
+    EXPECT_EQ(nodes[0], doc->get_root());
+    EXPECT_EQ(nodes[1], blocks[1].get());
+    EXPECT_EQ(nodes[2], blocks[1]->children[0].get());
+    EXPECT_EQ(nodes[3], blocks[2].get());
+    EXPECT_EQ(nodes[4], blocks[2]->children[0].get());
+    
+    EXPECT_TRUE(doc->nodes_in_range(5, 5).empty());
+}
+
+TEST_F(MarkdownParserTest, TypedQueriesAnswerFromTheIndex) {
+    std::string markdown = "# Setup\n\nSee [docs](docs.md) and [faq](faq.md).\n\n"
+                           "```mermaid\ngraph TD\n```\n\n```cpp\nint x;\n```\n\n"
+                           "# Usage\n\n> Quoted [link](quoted.md)\n\n```mermaid\npie\n```\n";
+    auto doc = parser->parse(markdown);
+    using NodeType = Document::NodeType;
+    
+    ASSERT_NE(doc, nullptr);
+    auto links = doc->nodes_of_type(NodeType::Link);
+    ASSERT_EQ(links.size(), 3);
+    EXPECT_EQ(links[0].node->link_url, "docs.md");
+    EXPECT_EQ(links[2].node->link_url, "quoted.md");
+    EXPECT_EQ(links[0].parent->type, NodeType::Paragraph);
+    EXPECT_EQ(links[0].depth, 2);
+    EXPECT_EQ(links[2].depth, 3);
+    
+    // Every node of a type, in document order
+    size_t headings = 0;
+    doc->visit([&headings](const Document::Node& node) { headings += node.type == NodeType::Heading; });
+    EXPECT_EQ(doc->nodes_of_type(NodeType::Heading).size(), headings);
+    EXPECT_TRUE(doc->nodes_of_type(NodeType::Table).empty());
+    
+    auto mermaid = doc->code_blocks("mermaid");
+    ASSERT_EQ(mermaid.size(), 2);
+    EXPECT_LT(mermaid[0].start, mermaid[1].start);
+    EXPECT_EQ(doc->code_blocks("cpp").size(), 1);
+    EXPECT_TRUE(doc->code_blocks("rust").empty());
+    
+    // Links under a heading, within a subtree and within a source range
+    const auto* usage = doc->find_anchor("usage");
+    ASSERT_NE(usage, nullptr);
+    auto usage_links = doc->nodes_of_type(NodeType::Link, *usage);
+    ASSERT_EQ(usage_links.size(), 1);
+    EXPECT_EQ(usage_links[0].node->link_url, "quoted.md");
+    EXPECT_EQ(doc->nodes_of_type(NodeType::CodeBlock, *doc->find_anchor("setup")).size(), 2);
+    
+    auto quotes = doc->nodes_of_type(NodeType::BlockQuote);
+    ASSERT_EQ(quotes.size(), 1);
+    EXPECT_EQ(doc->nodes_of_type(NodeType::Link, quotes[0]).data(), usage_links.data());
+    EXPECT_TRUE(doc->nodes_of_type(NodeType::Image, quotes[0]).empty());
+    
+    size_t faq = markdown.find("[faq]");
+    auto in_range = doc->nodes_of_type(NodeType::Link, faq, faq + 1);
+    ASSERT_EQ(in_range.size(), 1);
+    EXPECT_EQ(in_range[0].node->link_url, "faq.md");
+    
+    // The index follows changes to the tree
+    auto extra = doc->create_node(NodeType::Link);
+    extra->link_url = "extra.md";
+    doc->get_root()->children.back()->children.push_back(std::move(extra));
+    doc->mark_modified();
+    EXPECT_EQ(doc->nodes_of_type(NodeType::Link).size(), 4);
+}
+
+TEST_F(MarkdownParserTest, ReparseSingleCharacterEdit) {
+    std::string markdown = "# Title\n\nFirst paragraph here.\n\nSecond *paragraph*.\n\n- a\n- b\n";
+    size_t offset = markdown.find("here");
+    
+    auto doc = parser->parse(markdown);
+    const auto* untouched = doc->get_root()->children[0].get();
+    const auto* after_edit = doc->get_root()->children[2].get();
+    ASSERT_TRUE(parser->reparse(*doc, {offset, 0, "X"}));
+    
+    // Blocks outside the edit are kept, not rebuilt
+    EXPECT_EQ(doc->get_root()->children[0].get(), untouched);
+    EXPECT_EQ(doc->get_root()->children[2].get(), after_edit);
+    EXPECT_EQ(doc->get_root()->children[1]->children[0]->content, "First paragraph Xhere.");
+    EXPECT_EQ(after_edit->source_start, markdown.find("Second") + 1);
+    
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {offset, 0, "X"}));
+}
+
+TEST_F(MarkdownParserTest, ReparseStructuralEdits) {
+    std::string markdown = "Intro\n\n```\ncode\n```\n\nMiddle text\n\n> quote\n\nTail\n";
+    
+    // Opening a fence swallows everything after it
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.find("Middle"), 0, "```\n"}));
+    // Removing a closing fence does the same
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.find("```\n\n"), 4, ""}));
+    // Deleting a blank line joins two paragraphs
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.find("\n\nTail"), 1, ""}));
+    // Turning a paragraph into a heading, and replacing across blocks
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.find("Tail"), 0, "# "}));
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.find("code"), 20, "x\n\n- item\n"}));
+    // Edits at both ends
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {0, 0, "# "}));
+    EXPECT_TRUE(ReparseMatchesFullParse(*parser, markdown, {markdown.size(), 0, "\nmore"}));
+}
+
+TEST_F(MarkdownParserTest, ReparseRejectsOutOfRangeEdit) {
+    auto doc = parser->parse("Some text");
+    EXPECT_FALSE(parser->reparse(*doc, {4, 10, "x"}));
+    EXPECT_EQ(doc->source(), "Some text");
+}
+
+TEST_F(MarkdownParserTest, ReparseRandomEditsMatchFullParse) {
+    const std::vector<std::string> pieces = {
+        "# Heading\n", "Plain words here\n", "\n", "- item\n", "> quoted\n",
+        "```\n", "*em* and **strong**\n", "---\n", "[link](url)\n", "`code` &amp; more\n",
+    };
+    const std::vector<std::string> inserts = {"x", "\n", "\n\n", "```", "- ", "# ", "> ", "**", " "};
+    
+    std::mt19937 gen(1234);
+    for (int round = 0; round < 300; ++round) {
+        std::string markdown;
+        for (int i = 0; i < 20; ++i) {
+            markdown += pieces[gen() % pieces.size()];
+        }
+        
+        size_t offset = gen() % (markdown.size() + 1);
+        size_t removed = std::min<size_t>(gen() % 6, markdown.size() - offset);
+        std::string inserted = gen() % 3 == 0 ? "" : inserts[gen() % inserts.size()];
+        
+        ASSERT_TRUE(ReparseMatchesFullParse(*parser, markdown, {offset, removed, inserted}))
+            << "round " << round << ": " << markdown;
+    }
+}
+
+TEST_F(MarkdownParserTest, ReparseBoundsReplacedArenaMemory) {
+    std::string markdown;
+    for (int i = 0; i < 50; ++i) {
+        markdown += "Paragraph " + std::to_string(i) + " with *some* text.\n\n";
+    }
+    auto doc = parser->parse(markdown);
+    ASSERT_TRUE(doc->uses_arena());
+    
+    // Typing into one paragraph over and over replaces it each time; the
+    // replaced blocks never cover more than the source before a full
+    // parse lets them go
+    size_t offset = markdown.find("some");
+    size_t full_parses = 0;
+    for (int i = 0; i < 1000; ++i) {
+        size_t before = doc->replaced_bytes();
+        ASSERT_TRUE(parser->reparse(*doc, i % 2 ? MarkdownParser::Edit{offset, 1, ""}
+                                                : MarkdownParser::Edit{offset, 0, "x"}));
+        EXPECT_LE(doc->replaced_bytes(), doc->source().size());
+        full_parses += doc->replaced_bytes() < before;
+    }
+    EXPECT_GT(full_parses, 0u);
+    EXPECT_EQ(doc->source(), markdown);
+    EXPECT_TRUE(SameTree(*doc->get_root(), *parser->parse(markdown)->get_root()));
+}
+
+TEST_F(MarkdownParserTest, ReparseVersionSharesUnchangedBlocks) {
+    std::string before = "# Title\n\nFirst paragraph.\n\nSecond paragraph.\n\n- a\n- b\n";
+    std::shared_ptr<const Document> v1 = parser->parse(before);
+    
+    std::string after = before;
+    after.insert(after.find("Second"), "Now the ");
+    auto v2 = parser->reparse_version(v1, MarkdownParser::Edit::between(before, after), after);
+    ASSERT_NE(v2, nullptr);
+    EXPECT_EQ(v2->source(), after);
+    EXPECT_TRUE(SameTree(*v2->get_root(), *parser->parse(after)->get_root()));
+    EXPECT_EQ(v2->shared_depth(), 1);
+    
+    // The old version is untouched and shares the blocks before the edit
+    EXPECT_EQ(v1->source(), before);
+    EXPECT_TRUE(SameTree(*v1->get_root(), *parser->parse(before)->get_root()));
+    const auto& old_blocks = v1->get_root()->children;
+    const auto& new_blocks = v2->get_root()->children;
+    EXPECT_EQ(new_blocks[0].get(), old_blocks[0].get());
+    EXPECT_EQ(new_blocks[1].get(), old_blocks[1].get());
+    EXPECT_NE(new_blocks[2].get(), old_blocks[2].get());
+    
+    // An edit that keeps the length shares the blocks after it as well
+    std::string same_length = after;
+    same_length.replace(same_length.find("First"), 5, "FiRST");
+    auto v3 = parser->reparse_version(v2, MarkdownParser::Edit::between(after, same_length), same_length);
+    ASSERT_NE(v3, nullptr);
+    EXPECT_EQ(v3->get_root()->children[0].get(), old_blocks[0].get());
+    EXPECT_EQ(v3->get_root()->children.back().get(), new_blocks.back().get());
+    
+    // Versions outlive the ones they were made from
+    v1.reset();
+    v2.reset();
+    EXPECT_TRUE(SameTree(*v3->get_root(), *parser->parse(same_length)->get_root()));
+    EXPECT_EQ(v3->get_toc().entries.size(), 1);
+    
+    EXPECT_EQ(parser->reparse_version(v3, {same_length.size() + 1, 0, "x"}, same_length + "x"), nullptr);
+}
+
+TEST_F(MarkdownParserTest, ReparseVersionRandomEditsMatchFullParse) {
+    const std::vector<std::string> pieces = {
+        "# Heading\n", "Plain words here\n", "\n", "- item\n", "> quoted\n",
+        "```\n", "*em* and **strong**\n", "---\n", "[link](url)\n", "`code` &amp; more\n",
+    };
+    const std::vector<std::string> inserts = {"x", "\n", "\n\n", "```", "- ", "# ", "> ", "**", " "};
+    
+    std::mt19937 gen(4321);
+    std::string markdown;
+    for (int i = 0; i < 30; ++i) {
+        markdown += pieces[gen() % pieces.size()];
+    }
+    std::shared_ptr<const Document> version = parser->parse(markdown);
+    std::vector<std::pair<std::shared_ptr<const Document>, std::string>> kept;
+    size_t deepest = 0;
+    
+    for (int round = 0; round < 200; ++round) {
+        size_t offset = gen() % (markdown.size() + 1);
+        size_t removed = std::min<size_t>(gen() % 6, markdown.size() - offset);
+        std::string inserted = gen() % 3 == 0 ? "" : inserts[gen() % inserts.size()];
+        std::string edited = markdown;
+        edited.replace(offset, removed, inserted);
+        
+        version = parser->reparse_version(version, {offset, removed, inserted}, edited);
+        ASSERT_NE(version, nullptr);
+        ASSERT_TRUE(SameTree(*version->get_root(), *parser->parse(edited)->get_root())) << "round " << round;
+        deepest = std::max(deepest, version->shared_depth());
+        markdown = std::move(edited);
+        if (round % 25 == 0) {
+            kept.emplace_back(version, markdown);
+        }
+    }
+    
+    // Every version kept along the way still reads as it did
+    for (const auto& [old_version, text] : kept) {
+        EXPECT_TRUE(SameTree(*old_version->get_root(), *parser->parse(text)->get_root()));
+    }
+    // Full parses now and then keep the chain of shared versions short
+    EXPECT_GT(deepest, 1);
+    EXPECT_LE(deepest, 8);
+}
+
+TEST_F(MarkdownParserTest, ParseWithinLimitsMatchesPlainParse) {
+    std::string markdown = "# Title\n\nSome *text* with a [link](url).\n\n- a\n- b\n";
+    MarkdownParser::Limits limits{CancellationToken(), std::chrono::steady_clock::now() + std::chrono::hours(1)};
+    auto result = parser->parse(markdown, nullptr, limits);
+    
+    ASSERT_NE(result.document, nullptr);
+    EXPECT_TRUE(result.complete());
+    EXPECT_TRUE(SameTree(*result.document->get_root(), *parser->parse(markdown)->get_root()));
+}
+
+TEST_F(MarkdownParserTest, CancelledParseStopsEarly) {
+    std::string markdown;
+    for (int i = 0; i < 20000; ++i) {
+        markdown += "Paragraph " + std::to_string(i) + " with *some* text.\n\n";
+    }
+    size_t full = 0;
+    parser->parse(markdown)->visit([&full](const Document::Node&) { ++full; });
+    
+    // Cancelled before it starts
+    CancellationToken token;
+    token.cancel();
+    auto cancelled = parser->parse(markdown, nullptr, {token, std::nullopt});
+    ASSERT_NE(cancelled.document, nullptr);
+    EXPECT_EQ(cancelled.status, MarkdownParser::ParseStatus::Cancelled);
+    size_t partial = 0;
+    cancelled.document->visit([&partial](const Document::Node&) { ++partial; });
+    EXPECT_LT(partial, 100);
+    
+    // Past its deadline
+    auto late = parser->parse(markdown, nullptr, {std::nullopt, std::chrono::steady_clock::now()});
+    EXPECT_EQ(late.status, MarkdownParser::ParseStatus::TimedOut);
+    
+    // Cancelled from another thread while it runs
+    CancellationToken running;
+    std::thread canceller([running] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        running.cancel();
+    });
+    auto stopped = parser->parse(markdown, nullptr, {running, std::nullopt});
+    canceller.join();
+    if (!stopped.complete()) {
+        size_t nodes = 0;
+        stopped.document->visit([&nodes](const Document::Node&) { ++nodes; });
+        EXPECT_LT(nodes, full);
+        EXPECT_EQ(stopped.status, MarkdownParser::ParseStatus::Cancelled);
+    }
+}
+
+TEST_F(MarkdownParserTest, CancelledReparseVersionStopsEarly) {
+    std::string before;
+    for (int i = 0; i < 2000; ++i) {
+        before += "Paragraph " + std::to_string(i) + " with *some* text.\n\n";
+    }
+    std::shared_ptr<const Document> base = parser->parse(before);
+    size_t offset = before.find("Paragraph 1000");
+    
+    // Many new blocks are reparsed around the edit; a link definition
+    // sends it to a full parse instead. Either way a cancelled token stops it.
+    std::string blocks;
+    for (int i = 0; i < 500; ++i) {
+        blocks += "Inserted *block* " + std::to_string(i) + ".\n\n";
+    }
+    CancellationToken token;
+    token.cancel();
+    for (const std::string& inserted : {blocks, std::string("[label]: /url\n\n")}) {
+        std::string after = before;
+        after.insert(offset, inserted);
+        auto status = MarkdownParser::ParseStatus::Complete;
+        auto version = parser->reparse_version(base, {offset, 0, inserted}, after, nullptr,
+                                               {token, std::nullopt}, &status);
+        EXPECT_EQ(version, nullptr);
+        EXPECT_EQ(status, MarkdownParser::ParseStatus::Cancelled);
+        
+        auto late = parser->reparse_version(base, {offset, 0, inserted}, after, nullptr,
+                                            {std::nullopt, std::chrono::steady_clock::now()}, &status);
+        EXPECT_EQ(late, nullptr);
+        EXPECT_EQ(status, MarkdownParser::ParseStatus::TimedOut);
+        
+        // Within its limits it is the same as the unlimited reparse
+        auto complete = parser->reparse_version(base, {offset, 0, inserted}, after, nullptr,
+                                                {CancellationToken(), std::nullopt}, &status);
+        ASSERT_NE(complete, nullptr);
+        EXPECT_EQ(status, MarkdownParser::ParseStatus::Complete);
+        EXPECT_TRUE(SameTree(*complete->get_root(), *parser->parse(after)->get_root()));
+    }
+}
+
+TEST_F(MarkdownParserTest, ParallelParseMatchesSerialParse) {
+    const std::vector<std::string> pieces = {
+        "# Heading\n", "Plain words here\n", "\n", "\n", "- item\n", "> quoted\n",
+        "```\n", "code\n\nwith a gap\n", "*em* and **strong**\n", "---\n", "`code` &amp; more\n",
+    };
+    
+    std::mt19937 gen(42);
+    std::string markdown;
+    while (markdown.size() < 4 * 1024 * 1024) {
+        markdown += pieces[gen() % pieces.size()];
+    }
+    auto serial = parser->parse(markdown);
+    
+    for (size_t threads : {2, 4, 8, 0}) {
+        parser->set_parse_threads(threads);
+        auto parallel = parser->parse(markdown);
+        ASSERT_TRUE(SameTree(*parallel->get_root(), *serial->get_root())) << threads << " threads";
+        EXPECT_EQ(parallel->get_toc().entries.size(), serial->get_toc().entries.size());
+    }
+}
+
+TEST_F(MarkdownParserTest, ParallelParseHandlesBlocksSpanningChunks) {
+    // One fence left open near the start swallows every later chunk
+    std::string markdown = "# Title\n\n```\n";
+    while (markdown.size() < 4 * 1024 * 1024) {
+        markdown += "# not a heading\n\nsome code\n\n";
+    }
+    auto serial = parser->parse(markdown);
+    
+    parser->set_parse_threads(8);
+    auto parallel = parser->parse(markdown);
+    EXPECT_TRUE(SameTree(*parallel->get_root(), *serial->get_root()));
+    EXPECT_EQ(parallel->get_root()->children.size(), 2);
+}
+
+TEST_F(MarkdownParserTest, StreamingParserMatchesFullParse) {
+    const std::vector<std::string> pieces = {
+        "# Heading\n", "Plain words here\n", "\n", "\n", "- item\n", "> quoted\n",
+        "```\n", "code\n\nwith a gap\n", "*em* and **strong**\n", "---\n", "`code` &amp; more\n",
+    };
+    
+    std::mt19937 gen(7);
+    for (int round = 0; round < 200; ++round) {
+        std::string markdown;
+        for (int i = 0; i < 40; ++i) {
+            markdown += pieces[gen() % pieces.size()];
+        }
+        auto full = parser->parse(markdown);
+        const auto& expected = full->get_root()->children;
+        
+        size_t emitted = 0;
+        StreamingParser stream(*parser, [&](const Document::Node& block) {
+            ASSERT_LT(emitted, expected.size());
+            EXPECT_TRUE(SameTree(block, *expected[emitted])) << "round " << round << ": " << markdown;
+            ++emitted;
+        });
+        for (size_t offset = 0; offset < markdown.size();) {
+            size_t length = 1 + gen() % 40;
+            stream.feed(std::string_view(markdown).substr(offset, length));
+            offset += length;
+        }
+        stream.finish();
+        
+        ASSERT_EQ(emitted, expected.size()) << "round " << round << ": " << markdown;
+    }
+}
+
+TEST_F(MarkdownParserTest, StreamingParserEmitsBlocksBeforeFinish) {
+    size_t emitted = 0;
+    size_t max_buffered = 0;
+    StreamingParser stream(*parser, [&](const Document::Node&) { ++emitted; });
+    
+    std::string paragraph = "Some words in a paragraph\nthat runs over two lines.\n\n";
+    for (int i = 0; i < 10000; ++i) {
+        stream.feed(paragraph);
+        max_buffered = std::max(max_buffered, stream.buffered_bytes());
+    }
+    
+    // Held input stays around one open block, not the whole stream
+    EXPECT_GE(emitted, 9999);
+    EXPECT_LE(max_buffered, 2 * paragraph.size());
+    
+    stream.finish();
+    EXPECT_EQ(emitted, 10000);
+    EXPECT_EQ(stream.buffered_bytes(), 0);
+}
+
+TEST_F(MarkdownParserTest, EditBetweenFindsChangedRange) {
+    auto edit = MarkdownParser::Edit::between("hello world", "hello brave world");
+    EXPECT_EQ(edit.offset, 6);
+    EXPECT_EQ(edit.removed_len, 0);
+    EXPECT_EQ(edit.inserted_text, "brave ");
+    
+    edit = MarkdownParser::Edit::between("aaa", "a");
+    EXPECT_EQ(edit.offset + edit.removed_len, 3);
+    EXPECT_EQ(edit.removed_len, 2);
+    EXPECT_TRUE(edit.inserted_text.empty());
+}
+
+TEST_F(MarkdownParserTest, StatsCountDocumentSectionsAndRanges) {
+    std::string markdown =
+        "# One\n"
+        "\n"
+        "First [link](a) here\n"
+        "\n"
+        "## Sub\n"
+        "\n"
+        "```\n"
+        "code line\n"
+        "more\n"
+        "```\n"
+        "\n"
+        "# Two\n"
+        "\n"
+        "Last words";
+    auto doc = parser->parse(markdown);
+    
+    ASSERT_NE(doc, nullptr);
+    const auto& stats = doc->stats();
+    EXPECT_EQ(stats.words, 11);
+    EXPECT_EQ(stats.lines, 14);
+    EXPECT_EQ(stats.code_lines, 2);
+    EXPECT_EQ(stats.links, 1);
+    EXPECT_EQ(stats.words, doc->word_count());
+    EXPECT_EQ(stats.reading_minutes(5), 3);
+    
+    // "# One" runs up to "# Two" and takes "## Sub" with it
+    const auto& blocks = doc->get_root()->children;
+    auto one = doc->section_stats(blocks[0].get());
+    EXPECT_EQ(one.words, 8);
+    EXPECT_EQ(one.links, 1);
+    EXPECT_EQ(one.code_lines, 2);
+    EXPECT_EQ(one.lines, 11);
+    
+    auto sub = doc->section_stats(blocks[2].get());
+    EXPECT_EQ(sub.words, 4);
+    EXPECT_EQ(sub.links, 0);
+    
+    auto two = doc->section_stats(blocks[4].get());
+    EXPECT_EQ(two.words, 3);
+    EXPECT_EQ(two.lines, 3);
+    EXPECT_EQ(doc->section_stats(blocks[1].get()).words, 0);
+    
+    // Nodes starting inside the range (all of the code block's text), and
+    // the lines it touches
+    auto range = doc->stats_in_range(markdown.find("## Sub"), markdown.find("more"));
+    EXPECT_EQ(range.words, 4);
+    EXPECT_EQ(range.lines, 4);
+    EXPECT_EQ(doc->stats_in_range(10, 10).lines, 0);
+}
+
+TEST_F(MarkdownParserTest, StatsFollowTreeChanges) {
+    auto doc = parser->parse("one two");
+    ASSERT_NE(doc, nullptr);
+    EXPECT_EQ(doc->stats().words, 2);
+    EXPECT_EQ(doc->stats().images, 0);
+    
+    auto image = doc->create_node(Document::NodeType::Image);
+    image->children.push_back(doc->create_node(Document::NodeType::Text));
+    image->children.back()->content = "alt text here";
+    doc->get_root()->children.push_back(std::move(image));
+    doc->mark_modified();
+    
+    EXPECT_EQ(doc->stats().words, 5);
+    EXPECT_EQ(doc->stats().images, 1);
+}
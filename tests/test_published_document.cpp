@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "core/published_document.h"
+#include "core/markdown_parser.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mdviewer;
+
+TEST(PublishedDocumentTest, PublishesAndSwapsVersions) {
+    MarkdownParser parser;
+    PublishedDocument published;
+    EXPECT_EQ(published.snapshot(), nullptr);
+    EXPECT_EQ(published.generation(), 0);
+    
+    std::shared_ptr<const Document> first = parser.parse("# One\n");
+    EXPECT_EQ(published.publish(first), nullptr);
+    auto held = published.snapshot();
+    EXPECT_EQ(held, first);
+    
+    std::shared_ptr<const Document> second = parser.parse("# Two\n");
+    EXPECT_EQ(published.publish(second), first);
+    EXPECT_EQ(published.snapshot(), second);
+    EXPECT_EQ(published.generation(), 2);
+    
+    // A parse that started from `first` lost to `second`
+    std::shared_ptr<const Document> stale = parser.parse("# Three\n");
+    EXPECT_FALSE(published.publish_if_current(first, stale));
+    EXPECT_EQ(published.snapshot(), second);
+    EXPECT_TRUE(published.publish_if_current(second, stale));
+    EXPECT_EQ(published.snapshot(), stale);
+    
+    // A snapshot stays readable after its version is replaced
+    EXPECT_EQ(held->source(), "# One\n");
+}
+
+TEST(PublishedDocumentTest, ReadersSeeWholeVersionsWhileAWriterPublishes) {
+    MarkdownParser parser;
+    std::string text = "# Log\n\n";
+    PublishedDocument published(parser.parse(text));
+    
+    std::atomic<bool> done{false};
+    std::atomic<size_t> reads{0};
+    std::atomic<size_t> mismatches{0};
+    auto read = [&] {
+        while (!done.load()) {
+            auto snapshot = published.snapshot();
+            // Each entry adds two words and a link; the indexes are built
+            // lazily by whichever reader gets there first
+            std::string_view source = snapshot->source();
+            size_t entries = 0;
+            for (size_t pos = source.find("entry"); pos != std::string_view::npos; pos = source.find("entry", pos + 1)) {
+                ++entries;
+            }
+            if (snapshot->stats().words != 1 + 3 * entries ||
+                snapshot->nodes_of_type(Document::NodeType::Link).size() != entries ||
+                snapshot->node_at_offset(source.size() - 2) == nullptr) {
+                ++mismatches;
+            }
+            ++reads;
+        }
+    };
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back(read);
+    }
+    
+    for (int i = 0; i < 200; ++i) {
+        std::string entry = "entry [" + std::to_string(i) + "](n.md) here\n\n";
+        auto current = published.snapshot();
+        std::string edited = text + entry;
+        auto next = parser.reparse_version(current, {text.size(), 0, entry}, edited);
+        ASSERT_NE(next, nullptr);
+        EXPECT_TRUE(published.publish_if_current(current, std::move(next)));
+        text = std::move(edited);
+    }
+    while (reads.load() < 50) {
+        std::this_thread::yield();
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(published.snapshot()->source(), text);
+    EXPECT_EQ(published.snapshot()->stats().words, 601);
+}
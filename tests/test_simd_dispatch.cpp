@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "core/simd_dispatch.h"
+#include "core/structural_scanner.h"
+#include "core/text_counter.h"
+#include "utils/string_utils.h"
+#include <random>
+#include <string>
+
+using namespace mdviewer;
+
+namespace {
+
+// Random text over an alphabet weighted towards the bytes the kernels
+// classify, plus arbitrary high bytes
+std::string random_text(std::mt19937& rng, size_t length) {
+    static const std::string alphabet = "[[]]|#`~! \t\r\n\n\nab#c`~[]";
+    std::uniform_int_distribution<size_t> pick(0, alphabet.size() + 3);
+    std::string text;
+    text.reserve(length);
+    for (size_t i = 0; i < length; ++i) {
+        size_t choice = pick(rng);
+        text += choice < alphabet.size() ? alphabet[choice] : static_cast<char>(rng() & 0xFF);
+    }
+    return text;
+}
+
+// Inputs that hit the block and window edges or degenerate cases
+std::vector<std::string> adversarial_texts() {
+    std::vector<std::string> texts = {
+        "",
+        "[",
+        "]]",
+        std::string(64 * 1024 + 7, '['),
+        std::string(64 * 1024 + 7, ']'),
+        std::string(200 * 1024, '`'),
+        std::string(100000, '#'),
+        std::string(130, ' ') + "#tag",
+        std::string(3000, '\0'),
+    };
+    std::string pairs;
+    for (int i = 0; i < 40000; ++i) {
+        pairs += i % 3 ? "[[a|b]]" : "![[x]] `";
+    }
+    texts.push_back(pairs);
+    
+    std::string fences;
+    for (int i = 0; i < 5000; ++i) {
+        fences += i % 2 ? "```\n[[in]]\n" : "~~~~ #t\n";
+    }
+    texts.push_back(fences);
+    
+    // Every alignment of a link, tag and span against the 64-byte blocks
+    for (size_t offset = 0; offset < 130; ++offset) {
+        texts.push_back(std::string(offset, 'x') + "[[l|a]]\t#t `c` ~~~\n");
+    }
+    return texts;
+}
+
+// Mostly plain text with typographic punctuation and accents, salted with
+// everything the counter treats specially and with broken sequences
+std::string random_utf8(std::mt19937& rng, size_t length) {
+    static const char* const pieces[] = {
+        "word", " ", "\r\n", "\r", "\n", "\u00E9", "\u00A9", "\u0416", "\u2019", "\u2014", "\u2026",
+        "\u00A0", "\u0085", "\u2028", "\u202F", "\u205F", "\u20AC", "\u0301", "\u200D", "\uFE0F",
+        "\u4E16", "\u3001", "\uFF0C", "\U0001F468", "\U0001F3FD", "\U0001F1FA", "\xC3", "\xE2\x80",
+        "\xE2", "\x80", "\xF0\x9F", "\xFF",
+    };
+    std::uniform_int_distribution<size_t> pick(0, std::size(pieces) * 4 - 1);
+    std::string text;
+    while (text.size() < length) {
+        size_t choice = pick(rng);
+        // Three picks in four are plain
+        text += choice < std::size(pieces) ? pieces[choice] : choice % 2 ? "word" : " ";
+    }
+    text.resize(length);
+    return text;
+}
+
+// Valid UTF-8 made of the boundary codepoints of every sequence length,
+// with one byte overwritten at random in three texts out of four
+std::string random_utf8_with_error(std::mt19937& rng, size_t length) {
+    static const char* const pieces[] = {
+        "text ", "\u0080", "\u07FF", "\u0800", "\uD7FF", "\uE000", "\uFFFD", "\uFFFF",
+        "\U00010000", "\U0010FFFF", "\u00E9", "\u2019",
+    };
+    std::uniform_int_distribution<size_t> pick(0, std::size(pieces) - 1);
+    std::string text;
+    while (text.size() < length) {
+        text += pieces[pick(rng)];
+    }
+    if (!text.empty() && rng() % 4) {
+        text[rng() % text.size()] = static_cast<char>(rng() & 0xFF);
+    }
+    return text;
+}
+
+::testing::AssertionResult SameCounts(std::string_view text, SimdLevel level) {
+    auto expected = TextCounter::count(text, SimdLevel::Scalar);
+    auto counts = TextCounter::count(text, level);
+    if (counts.words != expected.words || counts.codepoints != expected.codepoints ||
+        counts.characters != expected.characters) {
+        return ::testing::AssertionFailure()
+            << SimdDispatch::name(level) << ": " << counts.words << "/" << counts.codepoints << "/"
+            << counts.characters << ", scalar " << expected.words << "/" << expected.codepoints << "/"
+            << expected.characters;
+    }
+    return ::testing::AssertionSuccess();
+}
+
+::testing::AssertionResult SameScan(std::string_view text, SimdLevel level) {
+    std::vector<Document::Link> expected_links, links;
+    std::vector<StructuralScanner::Tag> expected_tags, tags;
+    StructuralScanner::scan(text, expected_links, &expected_tags, SimdLevel::Scalar);
+    StructuralScanner::scan(text, links, &tags, level);
+    
+    if (links.size() != expected_links.size() || tags.size() != expected_tags.size()) {
+        return ::testing::AssertionFailure()
+            << SimdDispatch::name(level) << ": " << links.size() << " links and " << tags.size()
+            << " tags, scalar found " << expected_links.size() << " and " << expected_tags.size();
+    }
+    for (size_t i = 0; i < links.size(); ++i) {
+        if (links[i].url != expected_links[i].url || links[i].text != expected_links[i].text ||
+            links[i].position != expected_links[i].position || links[i].is_embed != expected_links[i].is_embed) {
+            return ::testing::AssertionFailure() << SimdDispatch::name(level) << ": link " << i << " differs";
+        }
+    }
+    for (size_t i = 0; i < tags.size(); ++i) {
+        if (tags[i].name != expected_tags[i].name || tags[i].position != expected_tags[i].position) {
+            return ::testing::AssertionFailure() << SimdDispatch::name(level) << ": tag " << i << " differs";
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+} // namespace
+
+TEST(SimdDispatchTest, ActiveLevelIsSupported) {
+    EXPECT_TRUE(SimdDispatch::supported(SimdLevel::Scalar));
+    EXPECT_TRUE(SimdDispatch::supported(SimdDispatch::active()));
+    EXPECT_TRUE(SimdDispatch::supported(SimdDispatch::detected()));
+    
+    auto levels = SimdDispatch::supported_levels();
+    ASSERT_FALSE(levels.empty());
+    EXPECT_EQ(levels.front(), SimdLevel::Scalar);
+    EXPECT_EQ(levels.back(), SimdDispatch::detected());
+}
+
+TEST(SimdDispatchTest, NamesRoundTrip) {
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON}) {
+        EXPECT_EQ(SimdDispatch::parse(SimdDispatch::name(level)), level);
+    }
+    EXPECT_FALSE(SimdDispatch::parse("sse9").has_value());
+    EXPECT_FALSE(SimdDispatch::parse("").has_value());
+}
+
+TEST(SimdDispatchTest, StructuralScannerLevelsMatchScalar) {
+    std::mt19937 rng(1234);
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        for (size_t length : {1, 63, 64, 65, 127, 1000, 70000}) {
+            for (int round = 0; round < 20; ++round) {
+                EXPECT_TRUE(SameScan(random_text(rng, length), level));
+            }
+        }
+        for (const auto& text : adversarial_texts()) {
+            EXPECT_TRUE(SameScan(text, level)) << "length " << text.size();
+        }
+    }
+}
+
+TEST(SimdDispatchTest, TextCountLevelsMatchScalar) {
+    std::mt19937 rng(5678);
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        for (size_t length : {0, 1, 63, 64, 65, 128, 1000, 70000}) {
+            for (int round = 0; round < 20; ++round) {
+                std::string text = random_text(rng, length);
+                EXPECT_TRUE(SameCounts(text, level)) << "length " << length;
+                text = random_utf8(rng, length);
+                EXPECT_TRUE(SameCounts(text, level)) << "length " << length;
+            }
+        }
+        for (const auto& text : adversarial_texts()) {
+            EXPECT_TRUE(SameCounts(text, level)) << "length " << text.size();
+        }
+    }
+}
+
+TEST(SimdDispatchTest, Utf8ValidationLevelsMatchScalar) {
+    std::mt19937 rng(9012);
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        for (size_t length : {0, 1, 63, 64, 65, 128, 1000, 70000}) {
+            for (int round = 0; round < 40; ++round) {
+                std::string text = random_utf8_with_error(rng, length);
+                EXPECT_EQ(StringUtils::find_invalid_utf8(text, level),
+                          StringUtils::find_invalid_utf8(text, SimdLevel::Scalar))
+                    << SimdDispatch::name(level) << ", length " << length;
+                text = random_utf8(rng, length);
+                EXPECT_EQ(StringUtils::find_invalid_utf8(text, level),
+                          StringUtils::find_invalid_utf8(text, SimdLevel::Scalar))
+                    << SimdDispatch::name(level) << ", length " << length;
+            }
+        }
+        for (const auto& text : adversarial_texts()) {
+            EXPECT_EQ(StringUtils::find_invalid_utf8(text, level),
+                      StringUtils::find_invalid_utf8(text, SimdLevel::Scalar))
+                << SimdDispatch::name(level) << ", length " << text.size();
+        }
+    }
+}
+
+TEST(SimdDispatchTest, HtmlEscapeLevelsMatchScalar) {
+    std::mt19937 rng(4242);
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        for (size_t length : {0, 1, 63, 64, 65, 200, 5000}) {
+            for (int round = 0; round < 20; ++round) {
+                // Sparse and dense markup
+                std::string text = random_utf8(rng, length);
+                for (size_t i = 0; i < text.size(); i += 1 + rng() % (round % 2 ? 4 : 300)) {
+                    text[i] = "<>&\"'"[rng() % 5];
+                }
+                std::string expected;
+                std::string escaped;
+                StringUtils::escape_html(text, expected, SimdLevel::Scalar);
+                StringUtils::escape_html(text, escaped, level);
+                EXPECT_EQ(escaped, expected) << SimdDispatch::name(level) << ", length " << length;
+            }
+        }
+        for (const auto& text : adversarial_texts()) {
+            std::string expected;
+            std::string escaped;
+            StringUtils::escape_html(text, expected, SimdLevel::Scalar);
+            StringUtils::escape_html(text, escaped, level);
+            EXPECT_EQ(escaped, expected) << SimdDispatch::name(level) << ", length " << text.size();
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include "core/slugger.h"
+
+using namespace mdviewer;
+
+TEST(SluggerTest, SlugifiesLikeGitHub) {
+    EXPECT_EQ(Slugger::slugify("Getting Started"), "getting-started");
+    EXPECT_EQ(Slugger::slugify("What's new in v2.0?"), "whats-new-in-v20");
+    EXPECT_EQ(Slugger::slugify("foo_bar - baz"), "foo_bar---baz");
+    EXPECT_EQ(Slugger::slugify("  Padded  "), "--padded--");
+    EXPECT_EQ(Slugger::slugify("C++ & Objective-C"), "c--objective-c");
+    EXPECT_EQ(Slugger::slugify("(Optional) [config]: `path`"), "optional-config-path");
+}
+
+TEST(SluggerTest, KeepsLettersOfOtherScripts) {
+    EXPECT_EQ(Slugger::slugify("CafÉ Über"), "café-über");
+    EXPECT_EQ(Slugger::slugify("Łódź"), "łódź");
+    EXPECT_EQ(Slugger::slugify("Δέλτα ПРИВЕТ"), "δέλτα-привет");
+    EXPECT_EQ(Slugger::slugify("日本語の見出し。"), "日本語の見出し");
+    // Emoji, dashes and curly quotes go
+    EXPECT_EQ(Slugger::slugify("\U0001F680 Launch — “day”"), "-launch--day");
+}
+
+TEST(SluggerTest, RepeatsGetNumbered) {
+    Slugger slugger;
+    EXPECT_EQ(slugger.slug("Example"), "example");
+    EXPECT_EQ(slugger.slug("Example"), "example-1");
+    EXPECT_EQ(slugger.slug("example"), "example-2");
+    // A heading that reads like a numbered repeat doesn't collide either
+    EXPECT_EQ(slugger.slug("Example 1"), "example-1-1");
+    EXPECT_EQ(slugger.slug("Example"), "example-3");
+    
+    slugger.reset();
+    EXPECT_EQ(slugger.slug("Example"), "example");
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include "utils/string_utils.h"
+#include <string>
+
+using namespace mdviewer;
+
+using Encoding = StringUtils::Encoding;
+
+namespace {
+
+constexpr size_t npos = std::string_view::npos;
+
+// The offset find_invalid_utf8 reports at every level
+::testing::AssertionResult InvalidAt(std::string_view text, size_t expected) {
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        size_t found = StringUtils::find_invalid_utf8(text, level);
+        if (found != expected) {
+            return ::testing::AssertionFailure()
+                << SimdDispatch::name(level) << " reports " << found << ", expected " << expected;
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+std::string decode(std::string_view bytes, Encoding encoding, bool lossy = false) {
+    std::string out;
+    EXPECT_TRUE(StringUtils::to_utf8(bytes, encoding, out, lossy));
+    return out;
+}
+
+} // namespace
+
+TEST(StringUtilsTest, ValidUtf8) {
+    EXPECT_TRUE(InvalidAt("", npos));
+    EXPECT_TRUE(InvalidAt("plain ASCII", npos));
+    // The first and last codepoint of each sequence length, and either
+    // side of the surrogates
+    EXPECT_TRUE(InvalidAt("\u0080\u07FF\u0800\uD7FF\uE000\uFFFF\U00010000\U0010FFFF", npos));
+    EXPECT_TRUE(StringUtils::is_valid_utf8("café — \U0001F44D"));
+}
+
+TEST(StringUtilsTest, ReportsTheFirstMalformedSequence) {
+    EXPECT_TRUE(InvalidAt("ab\x80", 2));              // stray continuation
+    EXPECT_TRUE(InvalidAt("ab\xC3", 2));              // truncated at the end
+    EXPECT_TRUE(InvalidAt("a\xE2\x80z", 1));          // truncated before ASCII
+    EXPECT_TRUE(InvalidAt("\xC0\xAF", 0));            // overlong '/'
+    EXPECT_TRUE(InvalidAt("\xE0\x9F\xBF", 0));        // overlong U+07FF
+    EXPECT_TRUE(InvalidAt("\xF0\x8F\xBF\xBF", 0));    // overlong U+FFFF
+    EXPECT_TRUE(InvalidAt("\xED\xA0\x80", 0));        // surrogate
+    EXPECT_TRUE(InvalidAt("\xF4\x90\x80\x80", 0));    // above U+10FFFF
+    EXPECT_TRUE(InvalidAt("\xF5\x80\x80\x80", 0));
+    EXPECT_TRUE(InvalidAt("ok é \xFF", 6));
+}
+
+TEST(StringUtilsTest, SequencesAcrossBlockEdges) {
+    // Each case lands at every alignment against the 64-byte blocks, after
+    // a mix of ASCII and multi-byte text
+    const std::string valid = "\xE0\xA0\x80\xED\x9F\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF\xC2\x80";
+    const std::string invalid[] = {"\xE0\x9F\x80", "\xED\xA0\x80", "\xF0\x8F\x80\x80", "\xF4\x90\x80\x80",
+                                   "\xC2", "\xE2\x82", "\xF0\x9F\x98"};
+    for (size_t offset = 0; offset < 140; ++offset) {
+        std::string prefix(offset, 'x');
+        if (offset % 3 == 0) {
+            prefix = std::string(offset / 3, 'x') + std::string(offset / 3 / 2, '\0') + "é";
+        }
+        EXPECT_TRUE(InvalidAt(prefix + valid + std::string(70, 'y'), npos)) << offset;
+        for (const std::string& bad : invalid) {
+            EXPECT_TRUE(InvalidAt(prefix + valid + bad + std::string(70, 'y'), prefix.size() + valid.size()))
+                << offset;
+        }
+    }
+}
+
+TEST(StringUtilsTest, DetectsEncodingFromByteOrderMarks) {
+    size_t bom = 99;
+    EXPECT_EQ(StringUtils::detect_encoding("\xEF\xBB\xBF# Title", &bom), Encoding::UTF8);
+    EXPECT_EQ(bom, 3);
+    EXPECT_EQ(StringUtils::detect_encoding(std::string_view("\xFF\xFE#\0", 4), &bom), Encoding::UTF16LE);
+    EXPECT_EQ(bom, 2);
+    EXPECT_EQ(StringUtils::detect_encoding(std::string_view("\xFE\xFF\0#", 4), &bom), Encoding::UTF16BE);
+    EXPECT_EQ(bom, 2);
+    EXPECT_EQ(StringUtils::detect_encoding("# Title", &bom), Encoding::UTF8);
+    EXPECT_EQ(bom, 0);
+
+    // UTF-16 without a mark, by its zero bytes
+    EXPECT_EQ(StringUtils::detect_encoding(std::string_view("#\0 \0T\0i\0t\0l\0e\0", 14)), Encoding::UTF16LE);
+    EXPECT_EQ(StringUtils::detect_encoding(std::string_view("\0#\0 \0T\0i\0t\0l\0e", 14)), Encoding::UTF16BE);
+}
+
+TEST(StringUtilsTest, TranscodesSingleByteEncodings) {
+    EXPECT_EQ(decode("caf\xE9 na\xEFve", Encoding::Latin1), "café naïve");
+    // 0x80-0x9F are C1 controls in Latin-1 and punctuation in Windows-1252
+    EXPECT_EQ(decode("\x93quoted\x94 \x96 \x80", Encoding::Latin1), "\u0093quoted\u0094 \u0096 \u0080");
+    EXPECT_EQ(decode("\x93quoted\x94 \x96 \x80\x81", Encoding::Windows1252), "“quoted” – €\u0081");
+
+    std::string long_text(1000, 'a');
+    long_text[500] = '\xE9';
+    std::string expected(500, 'a');
+    expected += "é" + std::string(499, 'a');
+    EXPECT_EQ(decode(long_text, Encoding::Windows1252), expected);
+}
+
+TEST(StringUtilsTest, TranscodesUtf16) {
+    const std::u16string text = u"# Café — \U0001F44D and more ASCII text";
+    std::string little;
+    std::string big;
+    for (char16_t unit : text) {
+        little += static_cast<char>(unit & 0xFF);
+        little += static_cast<char>(unit >> 8);
+        big += static_cast<char>(unit >> 8);
+        big += static_cast<char>(unit & 0xFF);
+    }
+    const std::string expected = "# Café — \U0001F44D and more ASCII text";
+    EXPECT_EQ(decode(little, Encoding::UTF16LE), expected);
+    EXPECT_EQ(decode(big, Encoding::UTF16BE), expected);
+
+    // An unpaired surrogate and an odd trailing byte
+    std::string broken("a\0\x3D\xD8" "b\0c", 7);
+    std::string out;
+    EXPECT_FALSE(StringUtils::to_utf8(broken, Encoding::UTF16LE, out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(decode(broken, Encoding::UTF16LE, true), "a�b�");
+}
+
+TEST(StringUtilsTest, RepairsMixedUtf8) {
+    std::string out = "kept ";
+    EXPECT_FALSE(StringUtils::to_utf8("café and caf\xE9", Encoding::UTF8, out));
+    EXPECT_EQ(out, "kept café and caf");
+
+    // Windows-1252 pasted into a UTF-8 note reads as Windows-1252
+    EXPECT_EQ(decode("café and caf\xE9 \x93quoted\x94 \xE9\xA9", Encoding::UTF8, true),
+              "café and café “quoted” é©");
+    EXPECT_EQ(decode("\xED\xA0\x80", Encoding::UTF8, true), "í\u00A0€");
+}
+
+TEST(StringUtilsTest, SubstringsCountCodepoints) {
+    EXPECT_EQ(StringUtils::utf8_substr("café au lait", 3, 4), "é au");
+    EXPECT_EQ(StringUtils::utf8_substr("漢字 \U0001F44D!", 1), "字 \U0001F44D!");
+    EXPECT_EQ(StringUtils::utf8_substr("漢字 \U0001F44D!", 3, 1), "\U0001F44D");
+    EXPECT_EQ(StringUtils::utf8_substr("é", 1), "");
+    EXPECT_EQ(StringUtils::utf8_substr("é", 5, 2), "");
+}
+
+TEST(StringUtilsTest, TrimsAndSplits) {
+    EXPECT_EQ(StringUtils::trim(" \t\r\n\v\fword  x\f\n"), "word  x");
+    EXPECT_EQ(StringUtils::trim_left("  a "), "a ");
+    EXPECT_EQ(StringUtils::trim_right("  a "), "  a");
+    EXPECT_EQ(StringUtils::trim(" \n "), "");
+    std::string text = "  kept  ";
+    EXPECT_EQ(StringUtils::trim_view(text).data(), text.data() + 2);
+
+    // getline's pieces: none after a final delimiter or for ""
+    using Pieces = std::vector<std::string>;
+    EXPECT_EQ(StringUtils::split("a,b,,c", ','), (Pieces{"a", "b", "", "c"}));
+    EXPECT_EQ(StringUtils::split(",a,,", ','), (Pieces{"", "a", ""}));
+    EXPECT_EQ(StringUtils::split(",", ','), (Pieces{""}));
+    EXPECT_EQ(StringUtils::split("", ','), Pieces{});
+
+    using Views = std::vector<std::string_view>;
+    EXPECT_EQ(StringUtils::split_view("a,,b,", ','), (Views{"a", "", "b", ""}));
+    EXPECT_EQ(StringUtils::split_view("", ','), (Views{""}));
+    Views ranged;
+    for (std::string_view piece : StringUtils::split_range("x|y||", '|')) {
+        ranged.push_back(piece);
+    }
+    EXPECT_EQ(ranged, (Views{"x", "y", "", ""}));
+
+    Views lines;
+    for (std::string_view line : StringUtils::lines("one\r\ntwo\n\nthree\r\n")) {
+        lines.push_back(line);
+    }
+    EXPECT_EQ(lines, (Views{"one", "two", "", "three"}));
+    EXPECT_EQ(std::distance(StringUtils::lines("").begin(), StringUtils::lines("").end()), 0);
+    EXPECT_EQ(std::distance(StringUtils::lines("\n").begin(), StringUtils::lines("\n").end()), 1);
+    EXPECT_EQ(*StringUtils::lines("no newline").begin(), "no newline");
+}
+
+TEST(StringUtilsTest, JoinsMapsCaseAndReplaces) {
+    EXPECT_EQ(StringUtils::join({"a", "", "b"}, ", "), "a, , b");
+    EXPECT_EQ(StringUtils::join({}, ", "), "");
+
+    // Long enough for whole words and a tail, with every byte around the
+    // letters' bounds
+    std::string mixed;
+    for (int c = 1; c < 256; ++c) {
+        mixed += static_cast<char>(c);
+    }
+    mixed += "Café ÀÉ MiXeD";
+    std::string lower = mixed;
+    std::string upper = mixed;
+    for (char& c : lower) {
+        c = c >= 'A' && c <= 'Z' ? c + 32 : c;
+    }
+    for (char& c : upper) {
+        c = c >= 'a' && c <= 'z' ? c - 32 : c;
+    }
+    EXPECT_EQ(StringUtils::to_lower(mixed), lower);
+    EXPECT_EQ(StringUtils::to_upper(mixed), upper);
+
+    EXPECT_EQ(StringUtils::replace_all("a.b.c", ".", "::"), "a::b::c");
+    EXPECT_EQ(StringUtils::replace_all("aaaa", "aa", "a"), "aa");
+    EXPECT_EQ(StringUtils::replace_all("abab", "ab", ""), "");
+    EXPECT_EQ(StringUtils::replace_all("none here", "xyz", "!"), "none here");
+    EXPECT_EQ(StringUtils::replace_all("kept", "", "!"), "kept");
+    std::string buffer = "> ";
+    StringUtils::replace_all("tab\there", "\t", "    ", buffer);
+    EXPECT_EQ(buffer, "> tab    here");
+}
+
+TEST(StringUtilsTest, EscapesHtml) {
+    EXPECT_EQ(StringUtils::escape_html("a < b && c > \"d\" 'e'"),
+              "a &lt; b &amp;&amp; c &gt; &quot;d&quot; &#39;e&#39;");
+    EXPECT_EQ(StringUtils::escape_html("plain café"), "plain café");
+
+    // Appends, so a buffer can be reused
+    std::string buffer = "<p>";
+    StringUtils::escape_html(std::string(100, 'x') + "<" + std::string(100, 'y'), buffer);
+    EXPECT_EQ(buffer, "<p>" + std::string(100, 'x') + "&lt;" + std::string(100, 'y'));
+}
+
+TEST(StringUtilsTest, UnescapesEveryHtmlEntity) {
+    EXPECT_EQ(StringUtils::unescape_html("&lt;b&gt; &amp;lt; &quot;q&quot; &#39;"), "<b> &lt; \"q\" '");
+    EXPECT_EQ(StringUtils::unescape_html("&copy; &eacute;t&eacute; &hellip; &nbsp;&NotEqualTilde; &fjlig;"),
+              "© été \u2026 \u00A0\u2242\u0338 fj");
+    EXPECT_EQ(StringUtils::unescape_html("&CounterClockwiseContourIntegral;&Afr;"), "∳\U0001D504");
+
+    EXPECT_EQ(StringUtils::unescape_html("&#65;&#x42;&#X43; &#128512;"), "ABC \U0001F600");
+    // Numbers that aren't characters, and C1 controls read as Windows-1252
+    EXPECT_EQ(StringUtils::unescape_html("&#0;&#xD800;&#x110000;&#99999999999;"), "\uFFFD\uFFFD\uFFFD\uFFFD");
+    EXPECT_EQ(StringUtils::unescape_html("&#x80;&#150;&#x81;"), "€–\u0081");
+
+    // Not references: left alone
+    EXPECT_EQ(StringUtils::unescape_html("AT&T & &amp &unknown; &#; &#x; &#12a; &;"),
+              "AT&T & &amp &unknown; &#; &#x; &#12a; &;");
+    EXPECT_EQ(StringUtils::unescape_html("&&&lt;&"), "&&<&");
+
+    std::string buffer = "kept ";
+    StringUtils::unescape_html("&alpha;&beta;", buffer);
+    EXPECT_EQ(buffer, "kept αβ");
+}
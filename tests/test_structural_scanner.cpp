@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "core/structural_scanner.h"
+#include <string>
+
+using namespace mdviewer;
+
+namespace {
+
+std::vector<Document::Link> links_in(std::string_view text) {
+    std::vector<Document::Link> links;
+    StructuralScanner::scan(text, links);
+    return links;
+}
+
+std::vector<std::string_view> tags_in(std::string_view text) {
+    std::vector<Document::Link> links;
+    std::vector<StructuralScanner::Tag> tags;
+    StructuralScanner::scan(text, links, &tags);
+    std::vector<std::string_view> names;
+    for (const auto& tag : tags) {
+        names.push_back(tag.name);
+    }
+    return names;
+}
+
+} // namespace
+
+TEST(StructuralScannerTest, FindsLinksEmbedsAndAliases) {
+    std::string text = "See [[Note]], ![[diagram.png]] and [[Other note#Part|the other one]].";
+    auto links = links_in(text);
+    
+    ASSERT_EQ(links.size(), 3);
+    EXPECT_EQ(links[0].url, "Note");
+    EXPECT_EQ(links[0].text, "Note");
+    EXPECT_EQ(links[0].position, text.find("[[Note"));
+    EXPECT_FALSE(links[0].is_embed);
+    
+    EXPECT_EQ(links[1].url, "diagram.png");
+    EXPECT_EQ(links[1].position, text.find('!'));
+    EXPECT_TRUE(links[1].is_embed);
+    
+    EXPECT_EQ(links[2].url, "Other note#Part");
+    EXPECT_EQ(links[2].text, "the other one");
+    for (const auto& link : links) {
+        EXPECT_TRUE(link.is_wikilink);
+    }
+}
+
+TEST(StructuralScannerTest, IgnoresUnclosedEmptyAndMultilineLinks) {
+    EXPECT_TRUE(links_in("[[never closed").empty());
+    EXPECT_TRUE(links_in("[[]] and ]] alone").empty());
+    EXPECT_TRUE(links_in("[[starts here\nends here]]").empty());
+    
+    // The innermost opener wins
+    auto links = links_in("[[outer [[inner]]");
+    ASSERT_EQ(links.size(), 1);
+    EXPECT_EQ(links[0].url, "inner");
+    EXPECT_EQ(links[0].position, 8);
+}
+
+TEST(StructuralScannerTest, SkipsCodeSpansAndFences) {
+    std::string text =
+        "`[[not a link]]` and ``[[nor `this`]]`` but [[yes]]\n"
+        "\n"
+        "```md\n"
+        "[[inside fence]] #fenced\n"
+        "```\n"
+        "~~~\n"
+        "[[tilde fence]]\n"
+        "~~~~\n"
+        "- ```\n"
+        "  [[list fence]]\n"
+        "  ```\n"
+        "after [[fences]] #tag\n";
+    auto links = links_in(text);
+    
+    ASSERT_EQ(links.size(), 2);
+    EXPECT_EQ(links[0].url, "yes");
+    EXPECT_EQ(links[1].url, "fences");
+    EXPECT_EQ(tags_in(text), std::vector<std::string_view>{"tag"});
+}
+
+TEST(StructuralScannerTest, UnmatchedBackticksAreLiteral) {
+    // No closing run of the same length, or only one past a blank line
+    EXPECT_EQ(links_in("a ``` b [[one]] ` c").size(), 1);
+    EXPECT_EQ(links_in("stray ` here [[two]]\n\nlater ` there").size(), 1);
+    EXPECT_EQ(links_in("\\`[[escaped]]`").size(), 1);
+    EXPECT_TRUE(links_in("```\nunclosed fence [[hidden]]\n").empty());
+}
+
+TEST(StructuralScannerTest, FindsTags) {
+    EXPECT_EQ(tags_in("#start middle #multi/level-tag_1 end #"),
+              (std::vector<std::string_view>{"start", "multi/level-tag_1"}));
+    EXPECT_EQ(tags_in("#café\tand\n#naïve"), (std::vector<std::string_view>{"café", "naïve"}));
+    
+    // Headings, numbers, anchors and entities are not tags
+    EXPECT_TRUE(tags_in("# Heading\n## Sub\nissue #42 url/#anchor &#123; a#b").empty());
+}
+
+TEST(StructuralScannerTest, PositionsAcrossBlockBoundaries) {
+    // Every alignment of the markers against the 64-byte blocks
+    for (size_t prefix = 0; prefix < 140; ++prefix) {
+        std::string text = std::string(prefix, 'x') + " ![[a|b]] `[[c]]` #d [[e]]";
+        std::vector<Document::Link> links;
+        std::vector<StructuralScanner::Tag> tags;
+        StructuralScanner::scan(text, links, &tags);
+        
+        ASSERT_EQ(links.size(), 2) << "prefix " << prefix;
+        EXPECT_EQ(links[0].position, prefix + 1);
+        EXPECT_TRUE(links[0].is_embed);
+        EXPECT_EQ(links[0].text, "b");
+        EXPECT_EQ(links[1].url, "e");
+        ASSERT_EQ(tags.size(), 1) << "prefix " << prefix;
+        EXPECT_EQ(tags[0].position, text.find('#'));
+    }
+}
+
+TEST(StructuralScannerTest, LargeTextMatchesPerPieceCounts) {
+    // Long enough for code spans and links to straddle internal windows
+    std::string text;
+    size_t pieces = 0;
+    while (text.size() < 300 * 1024) {
+        text += "[[note " + std::to_string(pieces) + "|n]] `code [[skipped]]` #tag" + std::to_string(pieces) + " ";
+        ++pieces;
+    }
+    std::vector<Document::Link> links;
+    std::vector<StructuralScanner::Tag> tags;
+    StructuralScanner::scan(text, links, &tags);
+    
+    ASSERT_EQ(links.size(), pieces);
+    ASSERT_EQ(tags.size(), pieces);
+    EXPECT_EQ(links.back().url, "note " + std::to_string(pieces - 1));
+    EXPECT_EQ(tags.back().name, "tag" + std::to_string(pieces - 1));
+}
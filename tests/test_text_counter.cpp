@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "core/text_counter.h"
+#include <string>
+
+using namespace mdviewer;
+
+TEST(TextCounterTest, CountsAsciiWords) {
+    EXPECT_EQ(TextCounter::count_words(""), 0);
+    EXPECT_EQ(TextCounter::count_words("  two words\n"), 2);
+    EXPECT_EQ(TextCounter::count_words("tab\tvertical\vform\ffeed\r\nend"), 5);
+    EXPECT_EQ(TextCounter::count_words("hyphen-ated, punctuated! (still) words"), 4);
+}
+
+TEST(TextCounterTest, UnicodeWhitespaceSeparatesWords) {
+    // NBSP, em space, narrow NBSP, ideographic space, zero width space
+    EXPECT_EQ(TextCounter::count_words("one\u00A0two\u2003three\u202Ffour\u3000five\u200Bsix"), 6);
+    // Typographic punctuation doesn't
+    EXPECT_EQ(TextCounter::count_words("\u201Cquoted\u201D it\u2019s \u2014 caf\u00E9"), 4);
+}
+
+TEST(TextCounterTest, EachCjkCharacterIsAWord) {
+    EXPECT_EQ(TextCounter::count_words("\u4F60\u597D\u4E16\u754C"), 4);
+    // Punctuation separates, Latin runs stay whole
+    EXPECT_EQ(TextCounter::count_words("\u4F60\u597D\uFF0C\u4E16\u754C\u3002"), 4);
+    EXPECT_EQ(TextCounter::count_words("Use\u306E\u30E9\u30A4\u30D6\u30E9\u30EAmdviewer"), 8);
+    // Hangul is written with spaces
+    EXPECT_EQ(TextCounter::count_words("\uD55C\uAD6D\uC5B4 \uBB38\uC7A5"), 2);
+}
+
+TEST(TextCounterTest, CountsCodepointsAndCharacters) {
+    auto counts = TextCounter::count("caf\u00E9 nai\u0308ve");
+    EXPECT_EQ(counts.codepoints, 11);
+    EXPECT_EQ(counts.characters, 10);  // the diaeresis combines
+    EXPECT_EQ(counts.words, 2);
+    
+    EXPECT_EQ(TextCounter::count("Hello").characters, 5);
+    EXPECT_EQ(TextCounter::count("a\r\nb\n\rc").characters, 6);
+}
+
+TEST(TextCounterTest, EmojiSequencesAreOneCharacter) {
+    // Skin tone, variation selector, ZWJ family, flag pair
+    EXPECT_EQ(TextCounter::count("\U0001F44D\U0001F3FD").characters, 1);
+    EXPECT_EQ(TextCounter::count("\u2764\uFE0F").characters, 1);
+    EXPECT_EQ(TextCounter::count("\U0001F468\u200D\U0001F469\u200D\U0001F467").characters, 1);
+    EXPECT_EQ(TextCounter::count("\U0001F1FA\U0001F1F8\U0001F1EB\U0001F1F7\U0001F1EE").characters, 3);
+    
+    auto family = TextCounter::count("\U0001F468\u200D\U0001F469\u200D\U0001F467");
+    EXPECT_EQ(family.codepoints, 5);
+    EXPECT_EQ(family.words, 1);
+}
+
+TEST(TextCounterTest, MalformedUtf8) {
+    // Truncated sequences count once, stray continuation bytes not at all
+    auto counts = TextCounter::count("a\xE2\x80 b\xC3");
+    EXPECT_EQ(counts.codepoints, 5);
+    EXPECT_EQ(counts.characters, 5);
+    EXPECT_EQ(counts.words, 2);
+    
+    counts = TextCounter::count("\x80\x80x \xC3\xA9\xA9\xA9 \xFF");
+    EXPECT_EQ(counts.codepoints, 5);
+    EXPECT_EQ(counts.words, 3);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "rendering/text_layout.h"
+#include "core/markdown_parser.h"
+#include <string>
+#include <vector>
+
+using namespace mdviewer;
+
+class TextLayoutTest : public ::testing::Test {
+protected:
+    MarkdownParser parser;
+    TextLayout layout;
+};
+
+TEST_F(TextLayoutTest, LaysOutEachTopLevelBlock) {
+    auto doc = parser.parse("# Heading\n\n"
+                            "Paragraph text.\n\n"
+                            "```\ncode\n```\n");
+    ASSERT_NE(doc, nullptr);
+    
+    auto paragraphs = layout.layout_document(doc.get());
+    ASSERT_EQ(paragraphs.size(), 3u);
+    EXPECT_LT(paragraphs[0].y, paragraphs[1].y);
+    EXPECT_LT(paragraphs[1].y, paragraphs[2].y);
+}
+
+TEST_F(TextLayoutTest, LaysOutBlocksInsideContainers) {
+    auto doc = parser.parse("> Quoted paragraph.\n\n"
+                            "- item one\n- item two\n");
+    ASSERT_NE(doc, nullptr);
+    
+    auto paragraphs = layout.layout_document(doc.get());
+    EXPECT_FALSE(paragraphs.empty());
+}
+
+TEST_F(TextLayoutTest, EmptyDocumentHasNoParagraphs) {
+    EXPECT_TRUE(layout.layout_document(nullptr).empty());
+    
+    auto doc = parser.parse("");
+    ASSERT_NE(doc, nullptr);
+    EXPECT_TRUE(layout.layout_document(doc.get()).empty());
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "core/markdown_parser.h"
+#include "core/text_offset_map.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace mdviewer;
+
+namespace {
+
+using LineColumn = TextOffsetMap::LineColumn;
+
+// Text mixing every UTF-8 sequence length with newlines, CR LF and the
+// odd stray continuation byte
+std::string random_text(std::mt19937& rng, size_t length) {
+    static const std::string pieces[] = {"a", "word ", "\n", "\r\n", "é", "—", "漢字", "\U0001F44D", "\x80", "\n\n"};
+    std::string text;
+    while (text.size() < length) {
+        text += pieces[rng() % std::size(pieces)];
+    }
+    return text;
+}
+
+// Counts before every byte offset, one at a time
+struct Reference {
+    std::vector<size_t> utf16;
+    std::vector<size_t> codepoints;
+    std::vector<size_t> lines;
+    std::vector<size_t> line_starts{0};
+
+    explicit Reference(std::string_view text) {
+        size_t units = 0;
+        size_t count = 0;
+        size_t newlines = 0;
+        for (size_t i = 0; i <= text.size(); ++i) {
+            utf16.push_back(units);
+            codepoints.push_back(count);
+            lines.push_back(newlines);
+            if (i == text.size()) {
+                break;
+            }
+            const unsigned char byte = text[i];
+            if ((byte & 0xC0) != 0x80) {
+                units += byte >= 0xF0 ? 2 : 1;
+                ++count;
+            }
+            if (byte == '\n') {
+                ++newlines;
+                line_starts.push_back(i + 1);
+            }
+        }
+    }
+};
+
+// Every conversion out of and back to every byte offset
+::testing::AssertionResult MatchesReference(const TextOffsetMap& map, std::string_view text) {
+    const Reference reference(text);
+    if (map.utf16_length() != reference.utf16.back() || map.codepoint_count() != reference.codepoints.back() ||
+        map.line_count() != reference.line_starts.size()) {
+        return ::testing::AssertionFailure() << "totals differ";
+    }
+    for (size_t byte = 0; byte <= text.size(); ++byte) {
+        const bool starts_sequence = byte == text.size() || (static_cast<unsigned char>(text[byte]) & 0xC0) != 0x80;
+        const size_t line = reference.lines[byte];
+        const LineColumn expected{line, reference.utf16[byte] - reference.utf16[reference.line_starts[line]]};
+        if (map.utf16_from_byte(byte) != reference.utf16[byte] ||
+            map.codepoint_from_byte(byte) != reference.codepoints[byte] ||
+            map.line_column_from_byte(byte) != expected) {
+            return ::testing::AssertionFailure() << "from byte " << byte;
+        }
+        if (starts_sequence && (map.byte_from_utf16(reference.utf16[byte]) > byte ||
+                                map.byte_from_codepoint(reference.codepoints[byte]) > byte ||
+                                map.byte_from_line_column(expected) > byte)) {
+            return ::testing::AssertionFailure() << "back to byte " << byte;
+        }
+    }
+    for (size_t line = 0; line < reference.line_starts.size(); ++line) {
+        if (map.line_start(line) != reference.line_starts[line]) {
+            return ::testing::AssertionFailure() << "start of line " << line;
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+} // namespace
+
+TEST(TextOffsetMapTest, ConvertsBetweenUnits) {
+    // é is two bytes and one unit, 漢 three bytes and one unit, the emoji
+    // four bytes and a surrogate pair
+    const std::string text = "é漢\U0001F44Dx\nsecond line\r\nthird";
+    TextOffsetMap map(text);
+    EXPECT_EQ(map.utf16_length(), 24u);
+    EXPECT_EQ(map.codepoint_count(), 23u);
+    EXPECT_EQ(map.line_count(), 3u);
+
+    EXPECT_EQ(map.utf16_from_byte(2), 1u);
+    EXPECT_EQ(map.utf16_from_byte(5), 2u);
+    EXPECT_EQ(map.utf16_from_byte(9), 4u);
+    EXPECT_EQ(map.codepoint_from_byte(9), 3u);
+    EXPECT_EQ(map.byte_from_utf16(4), 9u);
+    EXPECT_EQ(map.byte_from_codepoint(3), 9u);
+
+    // Inside a sequence, and between the halves of a surrogate pair
+    EXPECT_EQ(map.utf16_from_byte(1), 1u);
+    EXPECT_EQ(map.utf16_from_byte(6), 4u);
+    EXPECT_EQ(map.byte_from_utf16(3), 5u);
+
+    EXPECT_EQ(map.line_column_from_byte(9), (LineColumn{0, 4}));
+    EXPECT_EQ(map.line_column_from_byte(11), (LineColumn{1, 0}));
+    EXPECT_EQ(map.line_column_from_byte(text.size()), (LineColumn{2, 5}));
+    EXPECT_EQ(map.byte_from_line_column({1, 6}), 17u);
+    EXPECT_EQ(map.line_start(2), text.find("third"));
+}
+
+TEST(TextOffsetMapTest, ClampsPastTheEnd) {
+    const std::string text = "one\ntwo";
+    TextOffsetMap map(text);
+    EXPECT_EQ(map.utf16_from_byte(100), 7u);
+    EXPECT_EQ(map.byte_from_utf16(100), 7u);
+    EXPECT_EQ(map.byte_from_codepoint(100), 7u);
+    EXPECT_EQ(map.line_start(5), 7u);
+    // A column past its line stops at the newline
+    EXPECT_EQ(map.byte_from_line_column({0, 50}), 3u);
+    EXPECT_EQ(map.byte_from_line_column({9, 0}), 7u);
+
+    TextOffsetMap empty;
+    EXPECT_EQ(empty.line_count(), 1u);
+    EXPECT_EQ(empty.byte_from_line_column({0, 3}), 0u);
+    EXPECT_EQ(empty.line_column_from_byte(0), (LineColumn{0, 0}));
+}
+
+TEST(TextOffsetMapTest, LevelsMatchTheReference) {
+    std::mt19937 rng(23);
+    std::vector<std::string> texts = {"", "\n", std::string(5000, '\n'), std::string(3000, '\x80'),
+                                      random_text(rng, 300), random_text(rng, 20000)};
+    for (size_t offset = 0; offset < 70; ++offset) {
+        texts.push_back(std::string(offset, 'x') + "\U0001F44D\n漢");
+    }
+    for (SimdLevel level : SimdDispatch::supported_levels()) {
+        for (const std::string& text : texts) {
+            EXPECT_TRUE(MatchesReference(TextOffsetMap(text, level), text))
+                << SimdDispatch::name(level) << ", " << text.size() << " bytes";
+        }
+    }
+}
+
+TEST(TextOffsetMapTest, UpdateMatchesRebuild) {
+    std::mt19937 rng(2023);
+    std::string text = random_text(rng, 12000);
+    TextOffsetMap map(text);
+    for (int round = 0; round < 300; ++round) {
+        size_t offset = rng() % (text.size() + 1);
+        size_t removed = std::min<size_t>(rng() % (round % 10 == 0 ? 3000 : 8), text.size() - offset);
+        std::string inserted = random_text(rng, rng() % (round % 7 == 0 ? 2500 : 6));
+        text.replace(offset, removed, inserted);
+        map.update(text, offset, removed, inserted.size());
+        if (round % 25 == 0) {
+            ASSERT_TRUE(MatchesReference(map, text)) << "round " << round;
+        }
+    }
+    EXPECT_TRUE(MatchesReference(map, text));
+}
+
+TEST(TextOffsetMapTest, DocumentVersionsCarryTheMap) {
+    MarkdownParser parser;
+    std::string before;
+    for (int i = 0; i < 200; ++i) {
+        before += "## Section " + std::to_string(i) + "\n\nCafé — paragraph " + std::to_string(i) + ".\n\n";
+    }
+    std::shared_ptr<const Document> v1 = parser.parse(before);
+    EXPECT_EQ(v1->offset_map().line_count(), 801u);
+
+    std::string after = before;
+    size_t offset = after.find("Section 100");
+    after.insert(offset, "漢字\n");
+    auto v2 = parser.reparse_version(v1, {offset, 0, "漢字\n"}, after);
+    ASSERT_NE(v2, nullptr);
+    EXPECT_EQ(v2->offset_map().text().data(), v2->source().data());
+    EXPECT_TRUE(MatchesReference(v2->offset_map(), after));
+    EXPECT_TRUE(MatchesReference(v1->offset_map(), before));
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "core/toc_diff.h"
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mdviewer;
+
+namespace {
+
+using Kind = TOCDiff::Change::Kind;
+using Headings = std::vector<std::pair<int, std::string>>;
+
+// Nests headings the way Document::TableOfContents::generate does
+Document::TableOfContents make_toc(const Headings& headings) {
+    Document::TableOfContents toc;
+    std::vector<std::pair<int, std::vector<Document::TableOfContents::Entry>*>> open;
+    for (const auto& [level, text] : headings) {
+        while (!open.empty() && open.back().first >= level) {
+            open.pop_back();
+        }
+        auto& siblings = open.empty() ? toc.entries : *open.back().second;
+        auto& entry = siblings.emplace_back();
+        entry.level = level;
+        entry.text = text;
+        open.emplace_back(level, &entry.children);
+    }
+    return toc;
+}
+
+std::vector<std::pair<Kind, std::pair<size_t, size_t>>> changes(const TOCDiff::Script& script) {
+    std::vector<std::pair<Kind, std::pair<size_t, size_t>>> out;
+    for (const auto& change : script.changes) {
+        out.push_back({change.kind, {change.old_index, change.new_index}});
+    }
+    return out;
+}
+
+constexpr size_t npos = TOCDiff::npos;
+
+} // namespace
+
+TEST(TOCDiffTest, IdenticalTablesHaveNoChanges) {
+    auto toc = make_toc({{1, "Intro"}, {2, "Setup"}, {2, "Usage"}, {1, "Reference"}});
+    auto script = TOCDiff::compute(toc, toc);
+    
+    EXPECT_TRUE(script.empty());
+    EXPECT_EQ(script.matches, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+TEST(TOCDiffTest, InsertsAndRemoves) {
+    auto before = make_toc({{1, "Intro"}, {2, "Setup"}, {2, "Usage"}, {1, "Reference"}});
+    auto after = make_toc({{1, "Intro"}, {2, "Usage"}, {2, "Examples"}, {1, "Reference"}, {2, "API"}});
+    auto script = TOCDiff::compute(before, after);
+    
+    // "Examples" follows "Usage", which matched, so it can't take the place
+    // of "Setup"
+    EXPECT_EQ(changes(script), (std::vector<std::pair<Kind, std::pair<size_t, size_t>>>{
+                                   {Kind::Remove, {1, npos}},
+                                   {Kind::Insert, {npos, 2}},
+                                   {Kind::Insert, {npos, 4}},
+                               }));
+    EXPECT_EQ(script.matches, (std::vector<size_t>{0, 2, npos, 3, npos}));
+}
+
+TEST(TOCDiffTest, RetitlesInPlace) {
+    auto before = make_toc({{1, "Intro"}, {2, "Setup"}, {2, "Usage"}, {2, "Notes"}});
+    auto after = make_toc({{1, "Introduction"}, {2, "Setup"}, {2, "Using it"}, {3, "Caveats"}});
+    auto script = TOCDiff::compute(before, after);
+    
+    // "Caveats" changed level as well, so it's a new heading
+    EXPECT_EQ(changes(script), (std::vector<std::pair<Kind, std::pair<size_t, size_t>>>{
+                                   {Kind::Remove, {3, npos}},
+                                   {Kind::Retitle, {0, 0}},
+                                   {Kind::Retitle, {2, 2}},
+                                   {Kind::Insert, {npos, 3}},
+                               }));
+}
+
+TEST(TOCDiffTest, MovesFewestHeadings) {
+    // One section moved to the end
+    auto before = make_toc({{1, "A"}, {2, "A.1"}, {1, "B"}, {1, "C"}, {1, "D"}});
+    auto after = make_toc({{1, "B"}, {1, "C"}, {1, "D"}, {1, "A"}, {2, "A.1"}});
+    EXPECT_EQ(changes(TOCDiff::compute(before, after)),
+              (std::vector<std::pair<Kind, std::pair<size_t, size_t>>>{{Kind::Move, {0, 3}}}));
+    
+    // A subsection moved under another section
+    before = make_toc({{1, "A"}, {2, "Details"}, {1, "B"}});
+    after = make_toc({{1, "A"}, {1, "B"}, {2, "Details"}});
+    EXPECT_EQ(changes(TOCDiff::compute(before, after)),
+              (std::vector<std::pair<Kind, std::pair<size_t, size_t>>>{{Kind::Move, {1, 2}}}));
+}
+
+TEST(TOCDiffTest, DuplicateTitlesMatchInOrder) {
+    auto before = make_toc({{1, "Install"}, {2, "Example"}, {1, "Use"}, {2, "Example"}});
+    auto after = make_toc({{1, "Install"}, {2, "Example"}, {1, "Use"}, {2, "Example"}, {2, "Example"}});
+    auto script = TOCDiff::compute(before, after);
+    
+    EXPECT_EQ(changes(script), (std::vector<std::pair<Kind, std::pair<size_t, size_t>>>{{Kind::Insert, {npos, 4}}}));
+    EXPECT_EQ(script.matches, (std::vector<size_t>{0, 1, 2, 3, npos}));
+}
+
+TEST(TOCDiffTest, FlattensInPreOrder) {
+    auto toc = make_toc({{1, "A"}, {2, "A.1"}, {3, "A.1.a"}, {2, "A.2"}, {1, "B"}});
+    auto flat = TOCDiff::flatten(toc);
+    
+    ASSERT_EQ(flat.size(), 5);
+    std::vector<std::string> texts;
+    for (const auto& entry : flat) {
+        texts.push_back(entry.entry->text);
+    }
+    EXPECT_EQ(texts, (std::vector<std::string>{"A", "A.1", "A.1.a", "A.2", "B"}));
+    EXPECT_EQ(flat[3].parent, 0);
+    EXPECT_EQ(flat[3].sibling, 1);
+    EXPECT_EQ(flat[4].parent, npos);
+    EXPECT_EQ(flat[4].sibling, 1);
+}
+
+TEST(TOCDiffTest, ScriptsAccountForEveryHeading) {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 200; ++round) {
+        Headings before;
+        for (int i = 0; i < 40; ++i) {
+            before.push_back({1 + static_cast<int>(rng() % 3), "H" + std::to_string(rng() % 25)});
+        }
+        Headings after = before;
+        for (int edit = 0; edit < 6; ++edit) {
+            size_t at = rng() % after.size();
+            switch (rng() % 4) {
+                case 0:
+                    after.insert(after.begin() + at, {1 + static_cast<int>(rng() % 3), "N" + std::to_string(rng())});
+                    break;
+                case 1:
+                    after.erase(after.begin() + at);
+                    break;
+                case 2:
+                    after[at].second += "!";
+                    break;
+                default:
+                    std::swap(after[at], after[rng() % after.size()]);
+                    break;
+            }
+        }
+        
+        auto old_toc = make_toc(before);
+        auto new_toc = make_toc(after);
+        auto old_flat = TOCDiff::flatten(old_toc);
+        auto new_flat = TOCDiff::flatten(new_toc);
+        auto script = TOCDiff::compute(old_toc, new_toc);
+        ASSERT_EQ(script.matches.size(), new_flat.size());
+        
+        std::vector<int> old_seen(old_flat.size(), 0);
+        std::vector<bool> moved(new_flat.size(), false);
+        std::vector<bool> retitled(new_flat.size(), false);
+        for (const auto& change : script.changes) {
+            switch (change.kind) {
+                case Kind::Remove:
+                    ++old_seen[change.old_index];
+                    break;
+                case Kind::Insert:
+                    EXPECT_EQ(script.matches[change.new_index], npos);
+                    break;
+                case Kind::Move:
+                    moved[change.new_index] = true;
+                    EXPECT_EQ(script.matches[change.new_index], change.old_index);
+                    break;
+                case Kind::Retitle:
+                    retitled[change.new_index] = true;
+                    EXPECT_EQ(script.matches[change.new_index], change.old_index);
+                    break;
+            }
+        }
+        
+        // Each old heading is either removed or continued exactly once
+        for (size_t index = 0; index < new_flat.size(); ++index) {
+            size_t old_index = script.matches[index];
+            if (old_index == npos) {
+                continue;
+            }
+            ++old_seen[old_index];
+            EXPECT_EQ(retitled[index], old_flat[old_index].entry->text != new_flat[index].entry->text);
+        }
+        for (int seen : old_seen) {
+            EXPECT_EQ(seen, 1);
+        }
+        
+        // Headings that didn't move kept their parent and sibling order
+        std::vector<size_t> last_old_sibling(new_flat.size() + 1, npos);
+        for (size_t index = 0; index < new_flat.size(); ++index) {
+            size_t old_index = script.matches[index];
+            if (old_index == npos || moved[index]) {
+                continue;
+            }
+            size_t parent = new_flat[index].parent;
+            size_t old_parent = old_flat[old_index].parent;
+            EXPECT_EQ(parent == npos ? npos : script.matches[parent], old_parent);
+            size_t& last = last_old_sibling[parent == npos ? new_flat.size() : parent];
+            if (last != npos) {
+                EXPECT_LT(last, old_flat[old_index].sibling);
+            }
+            last = old_flat[old_index].sibling;
+        }
+    }
+}
@@ -39,7 +39,7 @@ Even more text
 # Chapter 2
 Final text
 )";
-    
+
     auto toc = generator->generate(markdown);
     
     ASSERT_EQ(toc.items.size(), 4);
@@ -62,7 +62,7 @@ TEST_F(TOCGeneratorTest, NestedHeadings) {
 ##### H5
 ###### H6
 )";
-    
+
     auto toc = generator->generate(markdown);
     
     ASSERT_EQ(toc.items.size(), 6);
@@ -77,7 +77,7 @@ TEST_F(TOCGeneratorTest, HeadingsWithSpecialCharacters) {
 ## Section with `code`
 ### Heading with [link](url)
 )";
-    
+
     auto toc = generator->generate(markdown);
     
     ASSERT_EQ(toc.items.size(), 3);
@@ -86,4 +86,62 @@ TEST_F(TOCGeneratorTest, HeadingsWithSpecialCharacters) {
     EXPECT_EQ(toc.items[2].title, "Heading with link");
 }
 
-} // namespace mdviewer
\ No newline at end of file
+TEST_F(TOCGeneratorTest, SetextHeadings) {
+    std::string markdown = "Title\n=====\n\nA two line\nsubtitle\n---\n\n- list item\n---\n\ntext\n***\n";
+    auto toc = generator->generate(markdown);
+    
+    ASSERT_EQ(toc.items.size(), 2);
+    EXPECT_EQ(toc.items[0].title, "Title");
+    EXPECT_EQ(toc.items[0].level, 1);
+    EXPECT_EQ(toc.items[0].offset, 0);
+    EXPECT_EQ(toc.items[1].title, "A two line subtitle");
+    EXPECT_EQ(toc.items[1].level, 2);
+    EXPECT_EQ(toc.items[1].offset, markdown.find("A two"));
+}
+
+TEST_F(TOCGeneratorTest, SkipsCodeAndNonHeadings) {
+    std::string markdown =
+        "```bash\n"
+        "# a comment\n"
+        "```\n"
+        "~~~~\n"
+        "# also code\n"
+        "```\n"
+        "~~~~\n"
+        "    # indented code\n"
+        "#hashtag\n"
+        "####### seven\n"
+        "#\n"
+        "   ### Real ###\n"
+        "> ## Quoted\n";
+    auto toc = generator->generate(markdown);
+    
+    ASSERT_EQ(toc.items.size(), 2);
+    EXPECT_EQ(toc.items[0].title, "Real");
+    EXPECT_EQ(toc.items[0].level, 3);
+    EXPECT_EQ(toc.items[1].title, "Quoted");
+}
+
+TEST_F(TOCGeneratorTest, BuildsHierarchy) {
+    std::string markdown = "## Intro\n# One\n### Deep\n## Two\n# Three\n";
+    auto toc = generator->generate(markdown);
+    
+    ASSERT_EQ(toc.items.size(), 5);
+    EXPECT_EQ(toc.roots, (std::vector<size_t>{0, 1, 4}));
+    EXPECT_EQ(toc.items[1].children, (std::vector<size_t>{2, 3}));
+    EXPECT_EQ(toc.items[2].parent, 1);
+    EXPECT_EQ(toc.items[3].parent, 1);
+    EXPECT_EQ(toc.items[4].parent, TOCGenerator::npos);
+}
+
+TEST_F(TOCGeneratorTest, StripsInlineMarkup) {
+    EXPECT_EQ(TOCGenerator::strip_inline_markup("*em* __strong__ ~~gone~~ snake_case_name"),
+              "em strong gone snake_case_name");
+    EXPECT_EQ(TOCGenerator::strip_inline_markup("``a `tick` here`` and `*kept*`"), "a `tick` here and *kept*");
+    EXPECT_EQ(TOCGenerator::strip_inline_markup("![logo](x.png) [a **b**](u) [ref][1] [[Note|alias]] [[Plain]]"),
+              "logo a b ref alias Plain");
+    EXPECT_EQ(TOCGenerator::strip_inline_markup("<b>html</b> <https://x.io> \\*literal\\* [no link] wow!"),
+              "html https://x.io *literal* [no link] wow!");
+}
+
+} // namespace mdviewer